@@ -2,8 +2,9 @@
  * @file automationsSeq.cpp
  * @brief Example: sequential and reference-based voice-leading and degree automations
  *
- * Demonstrates forward and backward voice-leading automations, reference
- * voicings, and degree-based automation utilities provided by the library.
+ * Demonstrates forward and backward voice-leading automations, globally optimal
+ * voice leading, reference voicings, and degree-based automation utilities
+ * provided by the library.
  *
  * @example
  */
@@ -34,6 +35,7 @@ int main(){
     std::cout << "Elapsed time: " << elapsed.count() << " ms\n\n";
     vector<PositionVector> reference = voiceLeadingAutomationReference(chords, IV6, complexities);
     vector<PositionVector> backward = voiceLeadingAutomationSequentialBackward(chords, complexities);
+    vector<PositionVector> optimal = optimalVoiceLeading(chords);
     vector<int> degrees = {0, 1, 2, 3, 4, 5, 6, 7, 6, 5, 4, 3, 2, 1, 0};
     vector<PositionVector> autogr = forwardDegreeAutomation(scale, crit, degrees, I, octaveRule);
     vector<PositionVector> autogr1 = degreeAutomationSequentialBackward(scale, crit, degrees, I, complexities);
@@ -56,6 +58,7 @@ int main(){
 
     printSequence("Sequential voice leading with reference moving from start to end:", forward);
     printSequence("Sequential voice leading from end to start:", backward);
+    printSequence("Voice leading with minimal total distance:", optimal);
     printSequence("Voice leading with reference vector:", reference);
     printSequence("Forward degree automation:", autogr);
     printSequence("Backwards degree automation:", autogr1);
@@ -75,6 +75,16 @@ int main() {
         }
         cout << "\n";
     }
+
+    cout << "Automatic root detection:\n";
+    for (const auto& chord : testChords) {
+        NamedChord best = nameChord(chord);
+        cout << "  ";
+        for (int note : chord) {
+            cout << note << " ";
+        }
+        cout << "-> " << best.name << " (root " << best.analysis.root << ")\n";
+    }
     
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,75 @@
+/**
+ * @file distancePolicies.cpp
+ * @brief Example: distance policies, evaluateDistance and templated calculateDistances
+ *
+ * Checks each distance policy against its distance function, evaluates one distance
+ * through a policy, function pointers (by reference and by value) and lambdas over
+ * vectors and over their data, and runs calculateDistances with each kind of callable
+ * on the same matrix.
+ *
+ * @example
+ */
+#include "../src/matrixDistance.h"
+
+string yesNo(bool value) {
+    return value ? "yes" : "no";
+}
+
+// A user distance with the by-value signature of DistanceFuncPV
+int manhattanByValue(PositionVector x, PositionVector y) {
+    return manhattanDistance(x, y);
+}
+
+int main(){
+
+    cout << "=== Policies and distance functions ===\n";
+    PositionVector a({0, 4, 7, 11});
+    PositionVector b({7, 11, 14, 17});
+    cout << "A: " << a << "  B: " << b << '\n';
+    cout << "Manhattan:  " << ManhattanDistancePolicy()(a, b) << " / " << manhattanDistance(a, b) << '\n';
+    cout << "Euclidean:  " << EuclideanDistancePolicy()(a, b) << " / " << euclideanDistance(a, b) << '\n';
+    cout << "Edit:       " << EditDistancePolicy()(a, b) << " / " << editDistance(a, b) << '\n';
+    cout << "Hamming:    " << HammingDistancePolicy()(a, b) << " / " << hammingDistance(a, b) << '\n';
+    cout << "Difference: " << DifferencePolicy()(a, b) << " / " << difference(a, b) << '\n';
+    cout << "Weighted:   " << WeightedTransformationDistancePolicy()(a, b)
+         << " / " << weightedTransformationDistance(a, b) << '\n';
+
+    cout << "\n=== evaluateDistance ===\n";
+    DistanceFuncRefPV pointer = manhattanDistance;
+    DistanceFuncPV byValue = manhattanByValue;
+    auto overVectors = [](const PositionVector& x, const PositionVector& y) { return manhattanDistance(x, y); };
+    auto overData = [](const VectorData& x, const VectorData& y) { return manhattanDistance(x, y); };
+    cout << "Manhattan: policy " << evaluateDistance(ManhattanDistancePolicy(), a, b)
+         << ", pointer " << evaluateDistance(pointer, a, b)
+         << ", by-value pointer " << evaluateDistance(byValue, a, b)
+         << ", lambda over vectors " << evaluateDistance(overVectors, a, b)
+         << ", lambda over data " << evaluateDistance(overData, a, b) << '\n';
+
+    cout << "\n=== calculateDistances ===\n";
+    PositionVector cMajor({0, 4, 7});
+    PositionVector gMajor({7, 11, 14});
+    RototranslationMatrix positions = rototranslationMatrix(gMajor, align(cMajor, gMajor));
+    auto byDefault = calculateDistances(cMajor, positions);
+    auto byPointer = calculateDistances(cMajor, positions, pointer);
+    auto byValuePointer = calculateDistances(cMajor, positions, byValue);
+    auto byPolicy = calculateDistances(cMajor, positions, ManhattanDistancePolicy());
+    auto byLambda = calculateDistances(cMajor, positions, overData);
+    cout << positions.size() << " rototranslations, default / pointers / policy / lambda identical: "
+         << yesNo(byDefault.getData() == byPointer.getData() && byPointer.getData() == byValuePointer.getData() &&
+                  byPointer.getData() == byPolicy.getData() && byPolicy.getData() == byLambda.getData()) << '\n';
+    auto euclidPolicy = calculateDistances(cMajor, positions, EuclideanDistancePolicy());
+    auto euclidLambda = calculateDistances(cMajor, positions,
+        [](const PositionVector& x, const PositionVector& y) { return euclideanDistance(x, y); });
+    cout << "Euclidean policy / lambda identical: " << yesNo(euclidPolicy.getData() == euclidLambda.getData()) << '\n';
+
+    IntervalVector lydian({2, 2, 2, 1, 2, 2, 1});
+    ModalMatrix<IntervalVector> modes = modalMatrix(IntervalVector({2, 2, 1, 2, 2, 2, 1}));
+    auto modesByDefault = calculateDistances(lydian, modes);
+    auto modesByPolicy = calculateDistances(lydian, modes, HammingDistancePolicy());
+    auto modesByPointer = calculateDistances(lydian, modes, static_cast<DistanceFuncRefIV>(hammingDistance));
+    cout << "Modes of the major scale from lydian, Hamming policy / pointer identical: "
+         << yesNo(modesByPolicy.getData() == modesByPointer.getData()) << '\n';
+    cout << "Closest mode (Manhattan): " << get<0>(modesByDefault.getData().front()) << '\n';
+
+    return 0;
+}
@@ -0,0 +1,133 @@
+/**
+ * @file editDistance.cpp
+ * @brief Example: edit distance variants and transformation steps
+ *
+ * Runs editDistance, editDistanceLinear, editDistanceBitParallel and editDistanceBounded
+ * on the same inputs, next to a full-matrix Levenshtein reference, then prints the
+ * transformation steps between vectors and checks that they rebuild the target.
+ *
+ * @example
+ */
+#include "../src/distances.h"
+
+// Reference: the textbook (n + 1) x (m + 1) Levenshtein matrix
+int fullMatrixEditDistance(const VectorData& a, const VectorData& b) {
+    vector<vector<int>> dp(a.size() + 1, vector<int>(b.size() + 1));
+    for (size_t i = 0; i <= a.size(); ++i) dp[i][0] = i;
+    for (size_t j = 0; j <= b.size(); ++j) dp[0][j] = j;
+    for (size_t i = 1; i <= a.size(); ++i) {
+        for (size_t j = 1; j <= b.size(); ++j) {
+            int substitution = dp[i - 1][j - 1] + (a[i - 1] != b[j - 1] ? 1 : 0);
+            dp[i][j] = min(substitution, min(dp[i - 1][j], dp[i][j - 1]) + 1);
+        }
+    }
+    return dp[a.size()][b.size()];
+}
+
+VectorData randomData(size_t size, int range) {
+    VectorData data;
+    for (size_t i = 0; i < size; ++i) {
+        data.push_back(rand() % range);
+    }
+    return data;
+}
+
+void printData(const VectorData& data) {
+    cout << '[';
+    for (size_t i = 0; i < data.size(); ++i) {
+        cout << (i ? ", " : "") << data[i];
+    }
+    cout << ']';
+}
+
+void printVariants(const string& name, const VectorData& a, const VectorData& b) {
+    cout << name << " (" << a.size() << " x " << b.size() << ")\n";
+    int reference = fullMatrixEditDistance(a, b);
+    cout << "  Full matrix:  " << reference << '\n';
+    cout << "  editDistance: " << editDistance(a, b) << '\n';
+    cout << "  Linear:       " << editDistanceLinear(a, b) << '\n';
+    try {
+        cout << "  BitParallel:  " << editDistanceBitParallel(a, b) << '\n';
+    } catch (const invalid_argument& e) {
+        cout << "(" << e.what() << ")\n";
+    }
+    cout << "  Bounded:     ";
+    // Below the distance the bounded variant stops at k + 1
+    for (int bound : set<int>{0, 1, max(0, reference - 1), reference, reference + 1}) {
+        cout << " k=" << bound << ": " << editDistanceBounded(a, b, bound);
+    }
+    cout << '\n';
+}
+
+// Applies transformation steps: shifts in place, then additions, then removals from the end
+VectorData applySteps(const VectorData& start, const vector<TransformationStep>& steps) {
+    VectorData out = start;
+    for (const auto& step : steps) {
+        if (step.first == 0) {
+            out[step.second.first] += step.second.second;
+        } else if (step.first == 1) {
+            out.push_back(step.second.second);
+        }
+    }
+    for (const auto& step : steps) {
+        if (step.first == 2) {
+            out.pop_back();
+        }
+    }
+    return out;
+}
+
+int main(){
+    srand(7);
+
+    cout << "=== Edit distance variants ===\n";
+    printVariants("C major / A minor triads", VectorData({0, 4, 7}), VectorData({9, 0, 4}));
+    printVariants("Identical", VectorData({0, 2, 4, 5, 7, 9, 11}), VectorData({0, 2, 4, 5, 7, 9, 11}));
+    printVariants("Empty / triad", VectorData(), VectorData({0, 4, 7}));
+    printVariants("Diatonic / pentatonic", VectorData({0, 2, 4, 5, 7, 9, 11}), VectorData({0, 2, 4, 7, 9}));
+    printVariants("64-element pattern", randomData(64, 4), randomData(70, 4));
+    printVariants("Both longer than 64", randomData(100, 4), randomData(90, 4));
+
+    cout << "\n=== Random pairs, lengths 0..80 ===\n";
+    size_t pairs = 2000;
+    size_t mismatches = 0;
+    for (size_t t = 0; t < pairs; ++t) {
+        VectorData a = randomData(rand() % 81, 1 + rand() % 12);
+        VectorData b = randomData(rand() % 81, 1 + rand() % 12);
+        int reference = fullMatrixEditDistance(a, b);
+        int bound = rand() % 20;
+        bool same = editDistance(a, b) == reference &&
+                    editDistanceLinear(a, b) == reference &&
+                    editDistanceBounded(a, b, bound) == min(reference, bound + 1);
+        if (min(a.size(), b.size()) <= 64) {
+            same = same && editDistanceBitParallel(a, b) == reference;
+        }
+        if (!same) {
+            ++mismatches;
+        }
+    }
+    cout << pairs << " pairs, " << mismatches << " mismatches\n";
+
+    cout << "\n=== Transformation steps ===\n";
+    vector<pair<VectorData, VectorData>> examples = {
+        {VectorData({0, 4, 7}), VectorData({0, 3, 7})},
+        {VectorData({0, 4, 7}), VectorData({0, 4, 7, 10, 14})},
+        {VectorData({0, 2, 4, 5, 7, 9, 11}), VectorData({0, 2, 3, 5})},
+        {VectorData({0, 4, 7}), VectorData({0, 4, 7})}
+    };
+    vector<TransformationStep> steps;
+    for (const auto& example : examples) {
+        // The buffer overload reuses steps across calls
+        transformationSteps(example.first, example.second, steps);
+        printData(example.first);
+        cout << " -> ";
+        printData(example.second);
+        cout << '\n';
+        printSteps(steps);
+        VectorData rebuilt = applySteps(example.first, steps);
+        cout << "  Rebuilds target: " << (rebuilt == example.second ? "yes" : "no")
+             << ", weighted distance: " << weightedTransformationDistance(example.first, example.second) << '\n';
+    }
+
+    return 0;
+}
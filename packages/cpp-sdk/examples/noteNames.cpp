@@ -176,6 +176,24 @@ int main() {
     }
     cout << endl;
 
+    // Batch spelling with the memoized cache
+    cout << "\n--- Test 9: Batch Spelling (Cached) ---" << endl;
+    vector<vector<int>> progression = {
+        {0, 2, 4, 5, 7, 9, 11},
+        {5, 7, 9, 10, 0, 2, 4},
+        {0, 2, 4, 5, 7, 9, 11},
+        {7, 11, 2, 5}
+    };
+    NoteSpellingBatch batch = system.spellBatch(progression, flatsDiatonic);
+    for (size_t i = 0; i < batch.size(); ++i) {
+        cout << "Set " << (i + 1) << ": ";
+        for (const string_view* note = batch.begin(i); note != batch.end(i); ++note) {
+            cout << *note << " ";
+        }
+        cout << endl;
+    }
+    cout << "Cached diatonic spellings: " << system.cachedSpellings() << endl;
+
     return 0;
 
 }
@@ -0,0 +1,95 @@
+/**
+ * @file parallel.cpp
+ * @brief Example: ThreadPool, parallel automations and parallel calculateDistances
+ *
+ * Runs the serial and parallel variants of the batch automations and of
+ * calculateDistances on the same inputs and checks that they give the same results,
+ * then shows parallelMap and how an exception thrown in a chunk reaches the caller.
+ *
+ * @example
+ */
+#include "../src/automations.h"
+
+template<typename MatrixDistance>
+bool sameRows(const MatrixDistance& a, const MatrixDistance& b) {
+    return a.getData() == b.getData();
+}
+
+int main(){
+
+    ThreadPool pool(4);
+    cout << "Threads in pool: " << pool.size() << "\n\n";
+
+    cout << "=== parallelMap (results in index order) ===\n";
+    vector<int> squares = pool.parallelMap(10, [](size_t i) { return static_cast<int>(i * i); });
+    for (int s : squares) cout << s << ' ';
+    cout << "\n\n";
+
+    // A progression of 500 chords, each voice-led to the previous one
+    PositionVector scale({0, 2, 4, 5, 7, 9, 11});
+    IntervalVector criterion({2, 2, 3});
+    vector<PositionVector> targets;
+    vector<PositionVector> references;
+    vector<int> degrees;
+    vector<int> complexities;
+    for (int i = 0; i < 500; ++i) {
+        int root = (i * 7) % 12;
+        targets.push_back(PositionVector({root, root + 4, root + 7}));
+        references.push_back(PositionVector({60 + i % 5, 64 + i % 3, 67}));
+        degrees.push_back(i % 7);
+        complexities.push_back((i * 13) % 101);
+    }
+
+    cout << "=== voiceLeadingAutomationVectorReference ===\n";
+    vector<PositionVector> vlSerial = voiceLeadingAutomationVectorReference(targets, references, complexities);
+    vector<PositionVector> vlParallel = voiceLeadingAutomationVectorReference(pool, targets, references, complexities);
+    for (size_t i = 0; i < 3; ++i) {
+        cout << "Serial: " << vlSerial[i] << "  Parallel: " << vlParallel[i] << '\n';
+    }
+    cout << "Identical: " << (vlSerial == vlParallel ? "yes" : "no") << "\n\n";
+
+    cout << "=== degreeAutomationVectorReference ===\n";
+    vector<PositionVector> dgSerial = degreeAutomationVectorReference(scale, criterion, degrees, references, complexities);
+    vector<PositionVector> dgParallel = degreeAutomationVectorReference(pool, scale, criterion, degrees, references, complexities);
+    for (size_t i = 0; i < 3; ++i) {
+        cout << "Serial: " << dgSerial[i] << "  Parallel: " << dgParallel[i] << '\n';
+    }
+    cout << "Identical: " << (dgSerial == dgParallel ? "yes" : "no") << "\n\n";
+
+    cout << "=== calculateDistances with and without a pool ===\n";
+    VectorData wide;
+    for (int i = 0; i < 600; ++i) wide.push_back(i * 5 + i % 3);
+    PositionVector source(wide, 12);
+    PositionVector reference(PositionVector(wide, 12) + 7);
+
+    TranspositionMatrix transpositions = transpositionMatrix(source);
+    bool transSame = sameRows(calculateDistances(reference, transpositions),
+                              calculateDistances(reference, transpositions, manhattanDistance, true, &pool));
+    cout << "Transposition matrix, " << transpositions.size() << " rows, identical: " << (transSame ? "yes" : "no") << '\n';
+
+    RototranslationMatrix rotations = rototranslationMatrix(source, align(reference, source));
+    bool rotoSame = sameRows(calculateDistances(reference, rotations, EuclideanDistancePolicy{}),
+                             calculateDistances(reference, rotations, EuclideanDistancePolicy{}, true, &pool));
+    cout << "Rototranslation matrix, " << rotations.size() << " rows, identical: " << (rotoSame ? "yes" : "no") << '\n';
+
+    ModalRototranslationMatrix modes = modalRototranslation(modalSelection(scale, criterion, 2));
+    PositionVector triad({62, 65, 69});
+    bool modalSame = sameRows(calculateDistances(triad, modes),
+                              calculateDistances(triad, modes, manhattanDistance, true, &pool));
+    cout << "Modal rototranslation matrix, " << modes.getTotalVectorCount() << " rows, identical: "
+         << (modalSame ? "yes" : "no") << "\n\n";
+
+    cout << "=== Exceptions thrown in a chunk ===\n";
+    try {
+        pool.parallelFor(1000, 10, [](size_t begin, size_t end) {
+            if (begin <= 500 && 500 < end) {
+                throw runtime_error("index 500 failed");
+            }
+        });
+        cout << "No exception\n";
+    } catch (const runtime_error& e) {
+        cout << "Caught after all chunks finished: " << e.what() << '\n';
+    }
+
+    return 0;
+}
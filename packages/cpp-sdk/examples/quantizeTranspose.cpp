@@ -0,0 +1,135 @@
+/**
+ * @file quantizeTranspose.cpp
+ * @brief Example: ScaleQuantizer and ScaleMapper against scalar quantize/transpose
+ *
+ * Quantizes notes with the free quantize() function and with the lookup tables of a
+ * ScaleQuantizer, then transposes a melody note by note with quantize(), with
+ * transpose() and with a ScaleMapper fed in small chunks. The results are printed
+ * and compared.
+ *
+ * @example
+ */
+#include "../src/quantizeTranspose.h"
+
+// Scalar reference: quantize the pitch class with the free function, keep the octave
+int scalarQuantize(int note, const vector<int>& scale, int mod, bool left) {
+    DivisionResult div = euclideanDivision(note, mod);
+    return div.quotient * mod + quantize(div.remainder, scale, left);
+}
+
+// Scalar reference for transpose(): one note at a time, searching the scales
+vector<int> scalarTranspose(const vector<int>& inScale, const vector<int>& outScale, int mod,
+                            int inRoot, int outRoot, const vector<int>& notes) {
+    vector<int> result;
+    int length = static_cast<int>(outScale.size());
+    auto degreeOf = [&inScale](int pc) {
+        auto it = find(inScale.begin(), inScale.end(), pc);
+        return it == inScale.end() ? -1 : static_cast<int>(distance(inScale.begin(), it));
+    };
+    for (size_t i = 0; i < notes.size(); ++i) {
+        DivisionResult div = euclideanDivision(notes[i] - inRoot, mod);
+        int degree = degreeOf(quantize(div.remainder, inScale, true));
+        if (degree == -1) {
+            continue;
+        }
+        int outNote = outScale[degree % length] + outRoot + div.quotient * mod;
+        // A different input note landing on the previous output tries the upper neighbor
+        if (!result.empty() && result.back() == outNote && i > 0 && notes[i] != notes[i - 1]) {
+            int right = degreeOf(quantize(div.remainder, inScale, false));
+            if (right != -1) {
+                outNote = outScale[right % length] + outRoot + div.quotient * mod;
+            }
+        }
+        result.push_back(outNote);
+    }
+    return result;
+}
+
+void printNotes(const string& label, const vector<int>& notes) {
+    cout << label;
+    for (int note : notes) {
+        cout << ' ' << note;
+    }
+    cout << '\n';
+}
+
+int main(){
+
+    PositionVector cMajor({0, 2, 4, 5, 7, 9, 11});
+    PositionVector pentatonic({0, 2, 4, 7, 9});
+    vector<int> majorValues(cMajor.getData().begin(), cMajor.getData().end());
+    ScaleQuantizer quantizer(cMajor);
+
+    cout << "=== Single notes (C major) ===\n";
+    cout << "note  scalar L/R  table L/R\n";
+    for (int note : {-13, -1, 1, 6, 10, 13, 61, 66}) {
+        cout << setw(4) << note
+             << setw(7) << scalarQuantize(note, majorValues, 12, true)
+             << setw(4) << scalarQuantize(note, majorValues, 12, false)
+             << setw(7) << quantizer.quantize(note, true)
+             << setw(4) << quantizer.quantize(note, false) << '\n';
+    }
+
+    cout << "\n=== Batch quantize, notes -60..71 ===\n";
+    vector<int> notes;
+    for (int note = -60; note < 72; ++note) {
+        notes.push_back(note);
+    }
+    for (bool left : {true, false}) {
+        vector<int> batch = quantizer.quantize(notes, left);
+        size_t mismatches = 0;
+        for (size_t i = 0; i < notes.size(); ++i) {
+            if (batch[i] != scalarQuantize(notes[i], majorValues, 12, left)) {
+                ++mismatches;
+            }
+        }
+        cout << (left ? "Left:  " : "Right: ") << notes.size() << " notes, "
+             << mismatches << " mismatches\n";
+    }
+
+    cout << "\n=== Transpose C major -> D pentatonic ===\n";
+    // Repeated notes, neighbors that collide on the output and notes below the root
+    vector<int> melody = {60, 61, 62, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 59, 58, 57, 48, 47, 73};
+    PositionVector degrees, transposed;
+    transpose(cMajor, pentatonic, 0, 2, melody, degrees, transposed);
+    vector<int> pentatonicValues(pentatonic.getData().begin(), pentatonic.getData().end());
+    vector<int> reference = scalarTranspose(majorValues, pentatonicValues, 12, 0, 2, melody);
+    printNotes("Input:           ", melody);
+    printNotes("Scalar:          ", reference);
+    cout << "transpose():      " << transposed << '\n';
+    cout << "Degrees:          " << degrees << '\n';
+
+    ScaleMapper mapper(quantizer, pentatonic, 0, 2);
+    vector<int> streamNotes(melody.size());
+    vector<int> streamDegrees(melody.size());
+    size_t written = 0;
+    const size_t chunk = 3;
+    for (size_t begin = 0; begin < melody.size(); begin += chunk) {
+        size_t count = min(chunk, melody.size() - begin);
+        written += mapper.process(melody.data() + begin, count,
+                                  streamNotes.data() + written, streamDegrees.data() + written);
+    }
+    streamNotes.resize(written);
+    streamDegrees.resize(written);
+    printNotes("process() x3:    ", streamNotes);
+    printNotes("Degrees:         ", streamDegrees);
+
+    const VectorData& expectedNotes = transposed.getData();
+    const VectorData& expectedDegrees = degrees.getData();
+    bool identical = reference == streamNotes &&
+                     vector<int>(expectedNotes.begin(), expectedNotes.end()) == streamNotes &&
+                     vector<int>(expectedDegrees.begin(), expectedDegrees.end()) == streamDegrees;
+    cout << "Identical: " << (identical ? "yes" : "no") << '\n';
+
+    cout << "\n=== reset() between streams ===\n";
+    mapper.reset();
+    vector<int> first(melody.size());
+    size_t firstCount = mapper.process(melody.data(), melody.size(), first.data());
+    mapper.reset();
+    vector<int> second(melody.size());
+    size_t secondCount = mapper.process(melody.data(), melody.size(), second.data());
+    cout << "Same output after reset: "
+         << (firstCount == secondCount && first == second ? "yes" : "no") << '\n';
+
+    return 0;
+}
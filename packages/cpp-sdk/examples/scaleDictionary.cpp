@@ -138,6 +138,29 @@ void runExamples() {
     cout << "\n--- Neapolitan Major in F ---" << endl;
     vector<int> neapolitanMajorF = {5, 6, 8, 10, 12, 14, 16};
     db.displayResults(neapolitanMajorF, getRootNote(neapolitanMajorF));
+    
+    cout << "\n--- Every scale that is a transposition of {2, 4, 5, 7, 9, 11, 0} ---" << endl;
+    vector<int> whiteKeys = {2, 4, 5, 7, 9, 11, 0};
+    for (const auto& [scale, transposition] : db.findScaleTranspositions(whiteKeys)) {
+        cout << getRootNote({transposition}) << " " << scale.scaleName << " (" << scale.sheetName << ")" << endl;
+    }
+    
+    cout << "\n--- Heptatonic scales on C containing a C7 chord {0, 4, 7, 10} ---" << endl;
+    for (const auto& scale : db.findScalesContaining({0, 4, 7, 10})) {
+        if (scale.intervals.size() == 7) {
+            cout << "C " << scale.scaleName << endl;
+        }
+    }
+    
+    cout << "\n--- Scales on C made only of the notes of C major ---" << endl;
+    for (const auto& scale : db.findScalesContainedIn({0, 2, 4, 5, 7, 9, 11})) {
+        cout << "C " << scale.scaleName << " (" << scale.intervals.size() << " notes)" << endl;
+    }
+    
+    cout << "\n--- 5 scales on A nearest to {9, 11, 0, 2, 4, 5, 8, 10} ---" << endl;
+    for (const auto& [scale, distance] : db.findNearestScales({9, 11, 0, 2, 4, 5, 8, 10}, 5, 9)) {
+        cout << "A " << scale.scaleName << " (distance " << distance << ")" << endl;
+    }
 }
 
 
@@ -0,0 +1,51 @@
+/**
+ * @file setClass.cpp
+ * @brief Example: normal form, prime forms and set-class ids
+ *
+ * Classifies well-known pitch-class sets and prints their normal order and their
+ * Tn and TnI prime forms next to the values listed in Rahn's tables.
+ *
+ * @example
+ */
+#include "../src/setClass.h"
+
+void printClass(const string& name, const PositionVector& set, const string& expectedPrime) {
+    SetClass sc = classifySet(set);
+    cout << name << ' ' << set << '\n';
+    cout << "  Normal form:    " << normalForm(set) << '\n';
+    cout << "  Tn prime form:  " << primeForm(set, false) << '\n';
+    cout << "  TnI prime form: " << primeForm(set) << "  (expected " << expectedPrime << ")\n";
+    cout << "  Chiral: " << (sc.chiral ? "yes" : "no")
+         << "  Inverted: " << (sc.inverted ? "yes" : "no")
+         << "  Id: " << setClassId(set) << '\n';
+}
+
+int main(){
+
+    cout << "=== Set classes (mod 12, Rahn prime forms) ===\n";
+    printClass("3-4", PositionVector({0, 4, 11}), "[0, 1, 5]");
+    printClass("3-11 major triad", PositionVector({0, 4, 7}), "[0, 3, 7]");
+    printClass("3-11 minor triad", PositionVector({0, 3, 7}), "[0, 3, 7]");
+    printClass("4-27 dominant seventh", PositionVector({7, 11, 14, 17}), "[0, 2, 5, 8]");
+    printClass("4-28 diminished seventh", PositionVector({1, 4, 7, 10}), "[0, 3, 6, 9]");
+    printClass("4-Z15", PositionVector({0, 1, 4, 6}), "[0, 1, 4, 6]");
+    printClass("4-Z29", PositionVector({0, 1, 3, 7}), "[0, 1, 3, 7]");
+    printClass("5-20 (Forte lists [0, 1, 3, 7, 8])", PositionVector({2, 3, 5, 9, 10}), "[0, 1, 5, 6, 8]");
+    printClass("6-35 whole tone", PositionVector({1, 3, 5, 7, 9, 11}), "[0, 2, 4, 6, 8, 10]");
+    printClass("7-35 diatonic", PositionVector({0, 2, 4, 5, 7, 9, 11}), "[0, 1, 3, 5, 6, 8, 10]");
+
+    cout << "\n=== Same class, different sets ===\n";
+    PositionVector cMajor({60, 64, 67});
+    PositionVector aMinor({57, 60, 64});
+    cout << "C major " << cMajor << " and A minor " << aMinor << '\n';
+    cout << "  Same TnI class: " << (setClassId(cMajor) == setClassId(aMinor) ? "yes" : "no") << '\n';
+    cout << "  Same Tn class:  " << (setClassId(cMajor, false) == setClassId(aMinor, false) ? "yes" : "no") << '\n';
+
+    cout << "\n=== Other moduli ===\n";
+    PositionVector heptatonicTriad(VectorData({0, 2, 4}), 7);
+    cout << "[0, 2, 4] mod 7, prime form: " << primeForm(heptatonicTriad) << '\n';
+    BinaryVector rhythm({1, 0, 0, 1, 0, 0, 1, 0}, 0, 8);
+    cout << "Tresillo " << rhythm << ", prime form mod 8: " << primeForm(rhythm) << '\n';
+
+    return 0;
+}
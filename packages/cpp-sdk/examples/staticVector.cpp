@@ -0,0 +1,64 @@
+/**
+ * @file staticVector.cpp
+ * @brief Example: compile-time position and interval vectors
+ *
+ * Builds the modes and the diatonic harmonization of the major scale at compile
+ * time and checks them against the dynamic Scale and select() results.
+ *
+ * @example
+ */
+#include "../src/scale.h"
+
+constexpr StaticIntervalVector<7> MAJOR({2, 2, 1, 2, 2, 2, 1});
+constexpr auto MODES = modeTable(MAJOR);
+constexpr auto TRIADS = harmonize<3>(MODES[0]);
+constexpr auto SEVENTHS = harmonize<4>(MODES[0]);
+
+static_assert(MODES[1] == StaticPositionVector<7>({0, 2, 3, 5, 7, 9, 10}), "Dorian");
+static_assert(TRIADS[4] == StaticPositionVector<3>({7, 11, 14}), "Dominant triad");
+static_assert(SEVENTHS[6][3] == 21, "Half-diminished seventh on B");
+static_assert(MODES[0].toIntervals() == MAJOR, "Round trip through positions");
+
+template<size_t N, int Mod>
+void printStatic(const StaticPositionVector<N, Mod>& v, const std::string& label) {
+    std::cout << "  " << label << ": " << v.toPositionVector() << std::endl;
+}
+
+int main() {
+    std::cout << "=== StaticPositionVector / StaticIntervalVector ===" << std::endl << std::endl;
+
+    std::cout << "Modes of the major scale (compile-time):" << std::endl;
+    for (size_t m = 0; m < MODES.size(); ++m) {
+        Scale scale(MAJOR, ScaleParams().withMode(static_cast<int>(m)));
+        printStatic(MODES[m], "Mode " + std::to_string(m));
+        if (!(scale.toPositions() == MODES[m].toPositionVector())) {
+            std::cout << "  Mismatch with Scale: " << scale.toPositions() << std::endl;
+            return 1;
+        }
+    }
+    std::cout << std::endl;
+
+    std::cout << "Diatonic triads and seventh chords (compile-time):" << std::endl;
+    PositionVector major = MODES[0];
+    for (size_t d = 0; d < TRIADS.size(); ++d) {
+        int degree = static_cast<int>(d);
+        PositionVector triad = select(major, PositionVector({degree, degree + 2, degree + 4}));
+        PositionVector seventh = select(major, PositionVector({degree, degree + 2, degree + 4, degree + 6}));
+        printStatic(TRIADS[d], "Triad   " + std::to_string(d + 1));
+        printStatic(SEVENTHS[d], "Seventh " + std::to_string(d + 1));
+        if (!(triad == TRIADS[d].toPositionVector()) || !(seventh == SEVENTHS[d].toPositionVector())) {
+            std::cout << "  Mismatch with select()" << std::endl;
+            return 1;
+        }
+    }
+    std::cout << std::endl;
+
+    std::cout << "Interoperability:" << std::endl;
+    StaticPositionVector<3> cMajor(PositionVector({0, 4, 7}));
+    printStatic(cMajor.rotoTranslate(1), "rotoTranslate(1)");
+    printStatic(cMajor.rotoTranslate<5>(-1), "rotoTranslate<5>(-1)");
+    printStatic(cMajor + 2, "Transposed by 2");
+    std::cout << "  Intervals: " << cMajor.toIntervals().toIntervalVector() << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,117 @@
+/**
+ * @file vectorBatch.cpp
+ * @brief Example: PositionVectorBatch and IntervalVectorBatch against per-vector calls
+ *
+ * Packs 500 chords and 500 interval shapes into batches, applies the batch operations
+ * and distances, and compares every row with the member functions, select and the
+ * distance policies applied to each vector.
+ *
+ * @example
+ */
+#include "../src/vectorBatch.h"
+#include "../src/selection.h"
+
+string yesNo(bool value) {
+    return value ? "yes" : "no";
+}
+
+// Same data and metadata, and the same effective range
+bool sameVectors(const vector<PositionVector>& a, const vector<PositionVector>& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a[i] != b[i] || a[i].getRange() != b[i].getRange()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename Vec, typename Op>
+vector<Vec> eachVector(const vector<Vec>& vectors, Op op) {
+    vector<Vec> out;
+    for (const Vec& v : vectors) {
+        out.push_back(op(v));
+    }
+    return out;
+}
+
+template<typename Vec, typename Dist>
+vector<double> eachDistance(const Vec& reference, const vector<Vec>& vectors, Dist distFunc) {
+    vector<double> out;
+    for (const Vec& v : vectors) {
+        out.push_back(distFunc(reference, v));
+    }
+    return out;
+}
+
+int main(){
+    srand(11);
+
+    cout << "=== PositionVectorBatch ===\n";
+    vector<PositionVector> chords;
+    for (int i = 0; i < 500; ++i) {
+        VectorData notes;
+        int note = rand() % 12;
+        for (int k = 0; k < 4; ++k) {
+            notes.push_back(note);
+            note += 1 + rand() % 7;
+        }
+        chords.push_back(PositionVector(notes));
+    }
+    PositionVectorBatch batch(chords);
+    cout << batch.size() << " rows of " << batch.length() << ", " << batch.values().size() << " values in one block\n";
+    PositionVector criterion({0, 2});
+    cout << "transpose(7):      " << yesNo(sameVectors(batch.transpose(7).toVectors(),
+        eachVector(chords, [](const PositionVector& pv) { return pv + 7; }))) << '\n';
+    cout << "rotate(1):         " << yesNo(sameVectors(batch.rotate(1).toVectors(),
+        eachVector(chords, [](const PositionVector& pv) { return pv.rotate(1); }))) << '\n';
+    cout << "rotoTranslate(-3): " << yesNo(sameVectors(batch.rotoTranslate(-3).toVectors(),
+        eachVector(chords, [](const PositionVector& pv) { return pv.rotoTranslate(-3); }))) << '\n';
+    cout << "inversion(2):      " << yesNo(sameVectors(batch.inversion(2).toVectors(),
+        eachVector(chords, [](const PositionVector& pv) { return pv.inversion(2); }))) << '\n';
+    cout << "select([0, 2], 1): " << yesNo(sameVectors(batch.select(criterion, 1).toVectors(),
+        eachVector(chords, [&criterion](const PositionVector& pv) { return select(pv, criterion, 1); }))) << '\n';
+
+    PositionVector reference({0, 4, 7, 11});
+    cout << "Distances from " << reference << " (batch kernel for all but edit):\n";
+    cout << "  Manhattan:  " << yesNo(batch.distances(reference, ManhattanDistancePolicy()) ==
+        eachDistance(reference, chords, ManhattanDistancePolicy())) << '\n';
+    cout << "  Euclidean:  " << yesNo(batch.distances(reference, EuclideanDistancePolicy()) ==
+        eachDistance(reference, chords, EuclideanDistancePolicy())) << '\n';
+    cout << "  Hamming:    " << yesNo(batch.distances(reference, HammingDistancePolicy()) ==
+        eachDistance(reference, chords, HammingDistancePolicy())) << '\n';
+    cout << "  Difference: " << yesNo(batch.distances(reference, DifferencePolicy()) ==
+        eachDistance(reference, chords, DifferencePolicy())) << '\n';
+    cout << "  Edit:       " << yesNo(batch.distances(reference, EditDistancePolicy()) ==
+        eachDistance(reference, chords, EditDistancePolicy())) << '\n';
+
+    cout << "\n=== IntervalVectorBatch ===\n";
+    vector<IntervalVector> shapes;
+    for (int i = 0; i < 500; ++i) {
+        VectorData steps;
+        for (int k = 0; k < 5; ++k) {
+            steps.push_back(1 + rand() % 4);
+        }
+        shapes.push_back(IntervalVector(steps, rand() % 12));
+    }
+    IntervalVectorBatch intervals(shapes);
+    IntervalVector indices({1, 2});
+    cout << intervals.size() << " rows of " << intervals.length() << '\n';
+    cout << "rotate(2):         " << yesNo(intervals.rotate(2).toVectors() ==
+        eachVector(shapes, [](const IntervalVector& iv) { return iv.rotate(2); })) << '\n';
+    cout << "rotoTranslate(7):  " << yesNo(intervals.rotoTranslate(7).toVectors() ==
+        eachVector(shapes, [](const IntervalVector& iv) { return iv.rotoTranslate(7); })) << '\n';
+    cout << "reverse():         " << yesNo(intervals.reverse().toVectors() ==
+        eachVector(shapes, [](const IntervalVector& iv) { return iv.reverse(); })) << '\n';
+    cout << "inversion(1):      " << yesNo(intervals.inversion(1).toVectors() ==
+        eachVector(shapes, [](const IntervalVector& iv) { return iv.inversion(1); })) << '\n';
+    cout << "select([1, 2]):    " << yesNo(intervals.select(indices).toVectors() ==
+        eachVector(shapes, [&indices](const IntervalVector& iv) { return select(iv, indices); })) << '\n';
+    IntervalVector shape({2, 2, 1, 2, 2});
+    cout << "Manhattan distances from " << shape << ": " << yesNo(intervals.distances(shape) ==
+        eachDistance(shape, shapes, ManhattanDistancePolicy())) << '\n';
+
+    return 0;
+}
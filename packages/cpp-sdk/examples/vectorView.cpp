@@ -0,0 +1,81 @@
+/**
+ * @file vectorView.cpp
+ * @brief Example: PositionVectorView and IntervalVectorView against owning vectors
+ *
+ * Reads caller buffers and batch rows through views and compares cyclic access,
+ * select, quantize and distances with the same calls on PositionVector and
+ * IntervalVector.
+ *
+ * @example
+ */
+#include "../src/vectorBatch.h"
+#include "../src/selection.h"
+#include "../src/quantizeTranspose.h"
+
+string yesNo(bool value) {
+    return value ? "yes" : "no";
+}
+
+int main(){
+    srand(11);
+
+    cout << "=== Views over caller buffers ===\n";
+    int midi[] = {60, 64, 67, 71};
+    PositionVectorView view = PositionVectorView::fromBuffer(midi, 4);
+    PositionVector owned({60, 64, 67, 71});
+    bool sameElements = view.getRange() == owned.getRange();
+    for (int i = -9; i < 9; ++i) {
+        sameElements = sameElements && view.element(i) == owned.element(i);
+    }
+    cout << "PositionVectorView " << view.toVector() << ", range " << view.getRange()
+         << ", cyclic access matches: " << yesNo(sameElements) << '\n';
+    int other[] = {62, 65, 69, 72};
+    PositionVectorView otherView = PositionVectorView::fromBuffer(other, 4);
+    cout << "Manhattan view / vector: " << manhattanDistance(view, otherView)
+         << " / " << manhattanDistance(owned, otherView.toVector()) << '\n';
+    PositionVector criterion({0, 2});
+    cout << "select(view, [0, 2]) == select(vector, [0, 2]): "
+         << yesNo(select(view, criterion) == select(owned, criterion)) << '\n';
+
+    int scale[] = {0, 2, 4, 5, 7, 9, 11};
+    PositionVectorView scaleView = PositionVectorView::fromBuffer(scale, 7);
+    vector<int> scaleValues(scale, scale + 7);
+    bool sameQuantize = true;
+    for (int note = 0; note < 12; ++note) {
+        sameQuantize = sameQuantize && quantize(note, scaleView, true) == quantize(note, scaleValues, true) &&
+                       quantize(note, scaleView, false) == quantize(note, scaleValues, false);
+    }
+    cout << "quantize over a view matches: " << yesNo(sameQuantize) << '\n';
+
+    int steps[] = {2, 2, 1, 2, 2, 2, 1};
+    IntervalVectorView stepsView = IntervalVectorView::fromBuffer(steps, 7, 5);
+    IntervalVector ownedSteps({2, 2, 1, 2, 2, 2, 1}, 5);
+    bool sameSteps = stepsView.getOffset() == ownedSteps.getOffset();
+    for (int i = -9; i < 9; ++i) {
+        sameSteps = sameSteps && stepsView.element(i) == ownedSteps.element(i);
+    }
+    cout << "IntervalVectorView " << stepsView.toVector() << ", cyclic access matches: " << yesNo(sameSteps) << '\n';
+
+    vector<PositionVector> chords;
+    for (int i = 0; i < 200; ++i) {
+        VectorData notes;
+        int note = rand() % 12;
+        for (int k = 0; k < 4; ++k) {
+            notes.push_back(note);
+            note += 1 + rand() % 7;
+        }
+        chords.push_back(PositionVector(notes));
+    }
+    PositionVectorBatch batch(chords);
+    PositionVector reference({0, 4, 7, 11});
+    bool rowsMatch = true;
+    for (size_t r = 0; r < batch.size(); ++r) {
+        rowsMatch = rowsMatch && manhattanDistance(batch.row(r), PositionVectorView(reference)) ==
+                                 manhattanDistance(chords[r], reference);
+    }
+    cout << "Batch rows as views, Manhattan matches: " << yesNo(rowsMatch) << '\n';
+    cout << "Batch row 0 as a view: " << batch.row(0).toVector() << " == " << chords[0] << ": "
+         << yesNo(batch.row(0).toVector() == chords[0]) << '\n';
+
+    return 0;
+}
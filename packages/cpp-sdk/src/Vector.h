@@ -2,6 +2,8 @@
 #define Vector_H
 
 #include "./vectors.h"
+#include <atomic>
+#include <mutex>
 
 /**
  * @file Vectors.h
@@ -20,13 +22,113 @@
  * - Binary Vector: presence/absence pattern in pitch space
  * 
  * All three representations are kept synchronized automatically.
- * Operations on any representation update all others.
+ * Synchronization is lazy: an operation stores only the representation it
+ * writes, and the other two are derived on first access through the getters.
+ * Positions are derived from whichever representation was written, intervals
+ * and binary are always derived from positions, so results match an eager
+ * update exactly.
+ *
+ * Const access is thread-safe: the first getter to need a representation derives
+ * it under a lock, and the states are atomic so later reads skip the lock.
  */
 class Vectors {
+private:
+    /**
+     * @brief Synchronization state of a single representation
+     */
+    enum class RepState {
+        Stale,    ///< Must be derived before use
+        Derived,  ///< Derived from the other representations
+        Given     ///< Written directly (constructor argument or operation result)
+    };
+
+    mutable PositionVector positions;
+    mutable IntervalVector intervals;
+    mutable BinaryVector binary;
+    mutable atomic<RepState> positionsState;
+    mutable atomic<RepState> intervalsState;
+    mutable atomic<RepState> binaryState;
+    // Serializes derivations; recursive because deriving intervals may derive positions
+    mutable recursive_mutex syncLock;
+
+    /**
+     * @brief Derives positions from the written representation if needed
+     */
+    void ensurePositions() const {
+        if (positionsState != RepState::Stale) return;
+        lock_guard<recursive_mutex> guard(syncLock);
+        if (positionsState != RepState::Stale) return;
+        positions = intervalsState == RepState::Given ? intervalsToPositions() : binaryToPositions();
+        positionsState = RepState::Derived;
+    }
+
+    /**
+     * @brief Derives intervals from positions if needed
+     */
+    void ensureIntervals() const {
+        if (intervalsState != RepState::Stale) return;
+        lock_guard<recursive_mutex> guard(syncLock);
+        if (intervalsState != RepState::Stale) return;
+        intervals = positionsToIntervals();
+        intervalsState = RepState::Derived;
+    }
+
+    /**
+     * @brief Derives binary from positions if needed
+     */
+    void ensureBinary() const {
+        if (binaryState != RepState::Stale) return;
+        lock_guard<recursive_mutex> guard(syncLock);
+        if (binaryState != RepState::Stale) return;
+        binary = positionsToBinary();
+        binaryState = RepState::Derived;
+    }
+
+    /**
+     * @brief Copies representations and states, holding the source lock so no derivation is half done
+     */
+    void copyFrom(const Vectors& other) {
+        lock_guard<recursive_mutex> guard(other.syncLock);
+        positions = other.positions;
+        intervals = other.intervals;
+        binary = other.binary;
+        positionsState = other.positionsState.load();
+        intervalsState = other.intervalsState.load();
+        binaryState = other.binaryState.load();
+        mod = other.mod;
+    }
+
+    /**
+     * @brief Builds a result that only holds the given positions
+     */
+    static Vectors withPositions(const PositionVector& pv, int modulo) {
+        Vectors result(modulo);
+        result.positions = pv;
+        result.updateFromPositions();
+        return result;
+    }
+
+    /**
+     * @brief Builds a result that only holds the given intervals
+     */
+    static Vectors withIntervals(const IntervalVector& iv, int modulo) {
+        Vectors result(modulo);
+        result.intervals = iv;
+        result.updateFromIntervals();
+        return result;
+    }
+
+    /**
+     * @brief Builds a result that only holds the given binary pattern
+     */
+    static Vectors withBinary(const BinaryVector& bv, int modulo) {
+        Vectors result(modulo);
+        result.binary = bv;
+        result.updateFromBinary();
+        return result;
+    }
+
 public:
-    PositionVector positions;
-    IntervalVector intervals;
-    BinaryVector binary;
     int mod;  ///< Global modulo for all representations
     
     // ==================== CONVERSION FUNCTIONS ====================
@@ -36,12 +138,13 @@ public:
      * @return IntervalVector derived from current positions
      */
     IntervalVector positionsToIntervals() const {
+        ensurePositions();
         if (positions.size() == 0) {
             return IntervalVector({}, 0, mod);
         }
         
-        vector<int> posData = positions.getData();
-        vector<int> intervalData;
+        const VectorData& posData = positions.getData();
+        VectorData intervalData;
         intervalData.reserve(positions.size());
         
         if (posData.size() > 1) {
@@ -58,11 +161,12 @@ public:
      * @return BinaryVector derived from current positions
      */
     BinaryVector positionsToBinary() const {
+        ensurePositions();
         if (positions.size() == 0) {
             return BinaryVector({}, 0, mod);
         }
         
-        vector<int> posData = positions.getData();
+        const VectorData& posData = positions.getData();
         int range = positions.getRange();
         vector<int> binaryData(range, 0);
         
@@ -82,14 +186,15 @@ public:
      * @return PositionVector derived from current intervals
      */
     PositionVector intervalsToPositions() const {
-        vector<int> intervalData = intervals.getData();
+        ensureIntervals();
+        const VectorData& intervalData = intervals.getData();
         
         if (intervalData.empty()) {
             return PositionVector({0}, mod, 0, true, false);
         }
         
         // Calculate positions from intervals (starting from offset)
-        vector<int> posData;
+        VectorData posData;
         posData.reserve(intervals.size());
         int currentPos = intervals.getOffset(); 
         posData.emplace_back(currentPos);
@@ -107,15 +212,13 @@ public:
      * @return PositionVector derived from current binary representation
      */
     PositionVector binaryToPositions() const {
-        vector<int> binaryData = binary.getData();
+        ensureBinary();
         int offset = binary.getOffset();
         
         // Extract positions where binary has 1s
-        vector<int> posData;
-        for (size_t i = 0; i < binaryData.size(); ++i) {
-            if (binaryData[i] == 1) {
-                posData.emplace_back(static_cast<int>(i) + offset);
-            }
+        VectorData posData = binary.getPulseIndices();
+        for (int& pos : posData) {
+            pos += offset;
         }
         
         if (posData.empty()) {
@@ -128,27 +231,30 @@ public:
     // ==================== UPDATE FUNCTIONS ====================
     
     /**
-     * @brief Updates intervals and binary from positions
+     * @brief Marks positions as written; intervals and binary are derived on access
      */
     void updateFromPositions() {
-        intervals = positionsToIntervals();
-        binary = positionsToBinary();
+        positionsState = RepState::Given;
+        intervalsState = RepState::Stale;
+        binaryState = RepState::Stale;
     }
     
     /**
-     * @brief Updates positions and binary from intervals
+     * @brief Marks intervals as written; positions and binary are derived on access
      */
     void updateFromIntervals() {
-        positions = intervalsToPositions();
-        binary = positionsToBinary();
+        intervalsState = RepState::Given;
+        positionsState = RepState::Stale;
+        binaryState = RepState::Stale;
     }
     
     /**
-     * @brief Updates positions and intervals from binary
+     * @brief Marks binary as written; positions and intervals are derived on access
      */
     void updateFromBinary() {
-        positions = binaryToPositions();
-        intervals = positionsToIntervals();
+        binaryState = RepState::Given;
+        positionsState = RepState::Stale;
+        intervalsState = RepState::Stale;
     }
 
 public:
@@ -161,6 +267,9 @@ public:
         : positions({0}, modulo, 0, true, false),
           intervals({}, 0, modulo),
           binary({1}, 0, modulo),
+          positionsState(RepState::Given),
+          intervalsState(RepState::Derived),
+          binaryState(RepState::Given),
           mod(modulo) 
     {}
     
@@ -194,22 +303,40 @@ public:
         updateFromBinary();
     }
     
+    Vectors(const Vectors& other) { copyFrom(other); }
+    
+    Vectors& operator=(const Vectors& other) {
+        if (this != &other) {
+            copyFrom(other);
+        }
+        return *this;
+    }
+    
     // ==================== GETTERS ====================
     
-    const PositionVector& getPositions() const { return positions; }
-    const IntervalVector& getIntervals() const { return intervals; }
-    const BinaryVector& getBinary() const { return binary; }
+    const PositionVector& getPositions() const { ensurePositions(); return positions; }
+    const IntervalVector& getIntervals() const { ensureIntervals(); return intervals; }
+    const BinaryVector& getBinary() const { ensureBinary(); return binary; }
     int getMod() const { return mod; }
     
     // ==================== POSITION OPERATIONS ====================
     
     /**
      * @brief Transpose positions
+     * @details Transposition only shifts the interval offset and the binary offset,
+     *          so already derived intervals and binary are carried over instead of rebuilt.
      */
     Vectors transpose(int amount) {
-        Vectors result(*this);
-        result.positions = positions + amount;
-        result.updateFromPositions();
+        Vectors result = withPositions(getPositions() + amount, mod);
+        if (intervalsState == RepState::Derived) {
+            result.intervals = intervals;
+            result.intervals.setOffset(intervals.getOffset() + amount);
+            result.intervalsState = RepState::Derived;
+        }
+        if (binaryState == RepState::Derived) {
+            result.binary = binary.transpose(amount);
+            result.binaryState = RepState::Derived;
+        }
         return result;
     }
     
@@ -217,37 +344,25 @@ public:
      * @brief Multiply positions by scalar
      */
     Vectors multiplyPositions(int scalar) {
-        Vectors result(*this);
-        result.positions = positions * scalar;
-        result.updateFromPositions();
-        return result;
+        return withPositions(getPositions() * scalar, mod);
     }
     
     Vectors negative(int axis = 10) {
-        Vectors result(*this);
-        result.positions = positions.negative(axis);
-        result.updateFromPositions();
-        return result;
+        return withPositions(getPositions().negative(axis), mod);
     }
     
     /**
      * @brief Rotate position vector
      */
     Vectors rotatePositions(int amount) {
-        Vectors result(*this);
-        result.positions = positions.rotate(amount);
-        result.updateFromPositions();
-        return result;
+        return withPositions(getPositions().rotate(amount), mod);
     }
     
     /**
      * @brief Rotate position vector
      */
     Vectors rototranslatePositions(int amount, int length = 0) {
-        Vectors result(*this);
-        result.positions = positions.rotoTranslate(amount, length);
-        result.updateFromPositions();
-        return result;
+        return withPositions(getPositions().rotoTranslate(amount, length), mod);
     }
 
     /**
@@ -261,20 +376,14 @@ public:
      * @brief Invert positions around axis
      */
     Vectors invertPositions(int axisIndex, bool sortOutput = true) {
-        Vectors result(*this);
-        result.positions = positions.inversion(axisIndex, sortOutput);
-        result.updateFromPositions();
-        return result;
+        return withPositions(getPositions().inversion(axisIndex, sortOutput), mod);
     }
     
     /**
      * @brief Complement of positions
      */
     Vectors complementPositions() {
-        Vectors result(*this);
-        result.positions = positions.complement();
-        result.updateFromPositions();
-        return result;
+        return withPositions(getPositions().complement(), mod);
     }
     
     // ==================== INTERVAL OPERATIONS ====================
@@ -283,50 +392,35 @@ public:
      * @brief Add to intervals
      */
     Vectors addToIntervals(int amount) {
-        Vectors result(*this);
-        result.intervals = intervals + amount;
-        result.updateFromIntervals();
-        return result;
+        return withIntervals(getIntervals() + amount, mod);
     }
     
     /**
      * @brief Multiply intervals by scalar
      */
     Vectors multiplyIntervals(int scalar) {
-        Vectors result(*this);
-        result.intervals = intervals * scalar;
-        result.updateFromIntervals();
-        return result;
+        return withIntervals(getIntervals() * scalar, mod);
     }
     
     /**
      * @brief Rotate interval vector
      */
     Vectors rotateIntervals(int amount) {
-        Vectors result(*this);
-        result.intervals = intervals.rotate(amount);
-        result.updateFromIntervals();
-        return result;
+        return withIntervals(getIntervals().rotate(amount), mod);
     }
     
     /**
      * @brief Reverse (retrograde) intervals
      */
     Vectors reverseIntervals() {
-        Vectors result(*this);
-        result.intervals = intervals.reverse();
-        result.updateFromIntervals();
-        return result;
+        return withIntervals(getIntervals().reverse(), mod);
     }
     
     /**
      * @brief Negate intervals
      */
     Vectors invertIntervals(int axisIndex) {
-        Vectors result(*this);
-        result.intervals = intervals.inversion(axisIndex);
-        result.updateFromIntervals();
-        return result;
+        return withIntervals(getIntervals().inversion(axisIndex), mod);
     }
         /**
      * @brief Alias for interval rotation
@@ -341,74 +435,54 @@ public:
     
     /**
      * @brief Rotate binary pattern
+     * @details Only the rotated pattern is stored; positions and intervals follow on access.
      */
     Vectors rotateBinary(int amount) {
-        Vectors result(*this);
-        result.binary = binary.rotate(amount);
-        result.updateFromBinary();
-        return result;
+        return withBinary(getBinary().rotate(amount), mod);
     }
     
     /**
      * @brief Complement binary pattern
      */
     Vectors complementBinary() {
-        Vectors result(*this);
-        result.binary = binary.complement();
-        result.updateFromBinary();
-        return result;
+        return withBinary(getBinary().complement(), mod);
     }
     
     /**
      * @brief Multiply (space out) binary pattern
      */
     Vectors multiplyBinary(int scalar) {
-        Vectors result(*this);
-        result.binary = binary * scalar;
-        result.mod = result.binary.getMod();
-        result.updateFromBinary();
-        return result;
+        BinaryVector scaled = getBinary() * scalar;
+        return withBinary(scaled, scaled.getMod());
     }
     
     /**
      * @brief Divide (compress) binary pattern
      */
     Vectors divideBinary(int divisor) {
-        Vectors result(*this);
-        result.binary = binary / divisor;
-        result.mod = result.binary.getMod();
-        result.updateFromBinary();
-        return result;
+        BinaryVector scaled = getBinary() / divisor;
+        return withBinary(scaled, scaled.getMod());
     }
     
     /**
      * @brief OR with another Vectors
      */
     Vectors operator|(const Vectors& other) const {
-        Vectors result(*this);
-        result.binary = binary | other.binary;
-        result.updateFromBinary();
-        return result;
+        return withBinary(getBinary() | other.getBinary(), mod);
     }
     
     /**
      * @brief AND with another Vectors
      */
     Vectors operator&(const Vectors& other) const {
-        Vectors result(*this);
-        result.binary = binary & other.binary;
-        result.updateFromBinary();
-        return result;
+        return withBinary(getBinary() & other.getBinary(), mod);
     }
     
     /**
      * @brief XOR with another Vectors
      */
     Vectors operator^(const Vectors& other) const {
-        Vectors result(*this);
-        result.binary = binary ^ other.binary;
-        result.updateFromBinary();
-        return result;
+        return withBinary(getBinary() ^ other.getBinary(), mod);
     }
     
     // ==================== UTILITY METHODS ====================
@@ -418,42 +492,42 @@ public:
      */
     void printAll() const {
         cout << "=== Vectors (mod=" << mod << ") ===" << endl;
-        cout << "Positions: " << positions << endl;
-        cout << "Intervals: " << intervals << endl;
-        cout << "Binary:    " << binary << endl;
+        cout << "Positions: " << getPositions() << endl;
+        cout << "Intervals: " << getIntervals() << endl;
+        cout << "Binary:    " << getBinary() << endl;
         cout << "Pattern:   ";
-        binary.printPattern();
+        getBinary().printPattern();
     }
     
     /**
      * @brief Print positions only
      */
     void printPositions() const {
-        cout << "Positions: " << positions << endl;
+        cout << "Positions: " << getPositions() << endl;
     }
     
     /**
      * @brief Print intervals only
      */
     void printIntervals() const {
-        cout << "Intervals: " << intervals << endl;
+        cout << "Intervals: " << getIntervals() << endl;
     }
     
     /**
      * @brief Print binary only
      */
     void printBinary() const {
-        cout << "Binary: " << binary << endl;
-        binary.printPattern();
+        cout << "Binary: " << getBinary() << endl;
+        getBinary().printPattern();
     }
     
     /**
      * @brief Compare equality
      */
     bool operator==(const Vectors& other) const {
-        return positions == other.positions && 
-               intervals == other.intervals && 
-               binary == other.binary;
+        return getPositions() == other.getPositions() && 
+               getIntervals() == other.getIntervals() && 
+               getBinary() == other.getBinary();
     }
     
     bool operator!=(const Vectors& other) const {
@@ -31,16 +31,73 @@
 ModalRototranslationMatrixRow degreeAutomation(PositionVector& scale, IntervalVector& criterion, int degree, PositionVector& reference, int complexity = 0){
     ModalSelectionMatrix sel = modalSelection(scale, criterion, degree);
     ModalRototranslationMatrix degrees = modalRototranslation(sel);
-    ModalRototranslationMatrixDistance distances = calculateDistances(reference, degrees);
-    ModalRototranslationMatrixRow out = distances.getByComplexity(complexity);
+    ModalRototranslationMatrixRow out = selectByComplexity(reference, degrees, complexity);
     return out;
 }
 
+/**
+ * @brief Fused voice-leading kernel with Manhattan distance
+ *
+ * Computes the same row as selecting by `complexity` in the Manhattan distances of
+ * rototranslationMatrix(target, align(reference, target)) against `reference`, without
+ * building the matrix or any distance row. Consecutive rototranslations differ by one
+ * element shift plus a range offset, so the current candidate is kept in a ring buffer
+ * and updated in O(1) per step; scoring a candidate is a single pass over the voices.
+ * For chords of up to 16 voices no heap allocation happens before the result vector.
+ *
+ * @param reference Reference PositionVector
+ * @param target Target PositionVector to be voice-led
+ * @param complexity Complexity factor (0-100), where 0 = closest, 100 = farthest
+ * @return Selected RototranslationMatrixRow, ties resolved as sortByDistance does
+ * @throws runtime_error if complexity is out of range
+ */
+RototranslationMatrixRow voiceLeadingKernel(const PositionVector& reference, const PositionVector& target, int complexity = 0){
+    int center = align(reference, target);
+    size_t n = target.size();
+    size_t count = 2 * n + 1;
+    size_t rank = complexityRank(complexity, count);
+    size_t length = min(reference.size(), n);
+    int first = center - static_cast<int>(n);
+    int range = abs(target.getRange());
+
+    // Candidate t holds target[t], ..., target[t + n - 1], starting from window[head]
+    VectorData window(n);
+    for (size_t i = 0; i < n; ++i) {
+        window[i] = target[first + static_cast<int>(i)];
+    }
+    size_t head = 0;
+
+    SmallVector<int, 33> distances(count);
+    for (size_t c = 0; c < count; ++c) {
+        int sum = 0;
+        size_t i = 0;
+        for (size_t k = head; k < n && i < length; ++k, ++i) {
+            sum += abs(reference.data[i] - window[k]);
+        }
+        for (size_t k = 0; i < length; ++k, ++i) {
+            sum += abs(reference.data[i] - window[k]);
+        }
+        distances[c] = sum;
+
+        // Next candidate drops target[t] and appends target[t + n] = target[t] + range
+        if (n > 0) {
+            window[head] += range;
+            head = (head + 1 == n) ? 0 : head + 1;
+        }
+    }
+
+    SmallVector<int, 33> order(count);
+    int selected = static_cast<int>(nthByDistance(distances, order, rank));
+    int translation = first + selected;
+    return RototranslationMatrixRow(target.rotoTranslate(translation), translation, distances[selected], center);
+}
+
 /**
  * @brief Compute best rototranslation to voice-lead `target` to `reference`
  *
  * Aligns `target` with `reference` and computes rototranslation distances
  * returning the selected best row according to `complexity`.
+ * Runs the fused voiceLeadingKernel, no matrix is built.
  *
  * @param reference Reference PositionVector
  * @param target Target PositionVector to be voice-led
@@ -48,11 +105,7 @@ ModalRototranslationMatrixRow degreeAutomation(PositionVector& scale, IntervalVe
  * @return Best matching RototranslationMatrixRow
  */
 RototranslationMatrixRow voiceLeadingAutomation(PositionVector& reference, PositionVector& target, int complexity = 0){
-    int center = align(reference, target);
-    RototranslationMatrix positions = rototranslationMatrix(target, center);
-    RototranslationMatrixDistance distances = calculateDistances(reference, positions);
-    RototranslationMatrixRow out = distances.getByComplexity(complexity);
-    return out;
+    return voiceLeadingKernel(reference, target, complexity);
 }
 
 /**
@@ -67,10 +120,9 @@ RototranslationMatrixRow voiceLeadingAutomation(PositionVector& reference, Posit
  * @return Best matching ModalMatrixRow<PositionVector>
  */
 ModalMatrixRow<PositionVector> modalInterchangeAutomation(PositionVector& scale, const vector<int>& notes, int complexity){
-    ModalMatrix<PositionVector> modes = modalMatrix(scale);
+    ModalMatrixView<PositionVector> modes = modalMatrixView(scale);
     ModalMatrix<PositionVector> filter = filterModalMatrix(modes, notes);
-    ModalMatrixDistance<PositionVector> distances = calculateDistances(scale, filter);
-    ModalMatrixRow<PositionVector> out = distances.getByComplexity(complexity);
+    ModalMatrixRow<PositionVector> out = selectByComplexity(scale, filter, complexity);
     return out;
 }
 
@@ -86,10 +138,9 @@ ModalMatrixRow<PositionVector> modalInterchangeAutomation(PositionVector& scale,
  * @return Best matching TranspositionMatrixRow
  */
 TranspositionMatrixRow modulationAutomation(PositionVector& scale, const vector<int>& notes, int complexity){
-    TranspositionMatrix transpositions = transpositionMatrix(scale);
+    TranspositionMatrixView transpositions = transpositionMatrixView(scale);
     TranspositionMatrix filter = filterTranspositionMatrix(transpositions, notes);
-    TranspositionMatrixDistance distances = calculateDistances(scale, filter);
-    TranspositionMatrixRow out = distances.getByComplexity(complexity);
+    TranspositionMatrixRow out = selectByComplexity(scale, filter, complexity);
     return out;
 }
 /**
@@ -155,6 +206,32 @@ vector<PositionVector> voiceLeadingAutomationVectorReference(
     return result;
 }
 
+/**
+ * @brief Parallel voiceLeadingAutomationVectorReference
+ * @param pool Pool running the (target, reference) pairs, see parallel.h
+ * @param targets Vector of target PositionVectors
+ * @param references Vector of reference PositionVectors (must match targets size)
+ * @param complexities Vector of complexity values (will be normalized to match targets size)
+ * @return Same vectors, in the same order, as the serial version
+ * @details The pairs are independent, each one runs as a task of the pool.
+ */
+vector<PositionVector> voiceLeadingAutomationVectorReference(
+    ThreadPool& pool,
+    vector<PositionVector>& targets,
+    vector<PositionVector>& references,
+    const vector<int>& complexities = vector<int>())
+{
+    if (targets.size() != references.size()) {
+        throw runtime_error("targets and references must have the same size");
+    }
+    
+    vector<int> normalizedComplexities = normalizeComplexityVector(complexities, targets.size());
+    
+    return pool.parallelMap(targets.size(), [&](size_t i) {
+        return voiceLeadingAutomation(targets[i], references[i], normalizedComplexities[i]).getVector();
+    });
+}
+
 /**
  * @brief Performs voice leading with custom reference positions
  * @param targets Vector of target PositionVectors
@@ -260,6 +337,114 @@ vector<PositionVector> voiceLeadingAutomationSequentialBackward(
     return result;
 }
 
+/**
+ * @brief Voice leading minimizing the total distance over the whole progression
+ * @param targets Vector of target PositionVectors (first element is kept as-is)
+ * @param complexities Maximum complexity per transition (will be normalized to targets.size() - 1),
+ *        empty for no constraint
+ * @param distFunc Distance function between consecutive voicings
+ * @return Vector of PositionVectors with voice leading applied
+ * @throws runtime_error if targets vector is empty or a complexity is out of range
+ * @details Candidates for targets[i] are the 2n + 1 rows of
+ *          rototranslationMatrix(targets[i], align(targets[0], targets[i])), which span about
+ *          one range above and below the first chord. A Viterbi pass over the candidates keeps,
+ *          for each voicing of chord i, the cheapest path reaching it, then backtracks from the
+ *          cheapest last voicing: the result minimizes the sum of distances between consecutive
+ *          chords, where forwardVoiceLeading only minimizes each step. Register is not part of
+ *          the cost, so the path can still move within the candidate window (a descending
+ *          progression may end about an octave below the first chord), but never beyond it.
+ *
+ *          A complexity c on transition i allows, from each voicing of chord i, only the voicings
+ *          of chord i + 1 up to the rank getByComplexity(c) would pick (0 = closest only,
+ *          100 = any). Equal costs favour the earlier candidate.
+ *
+ *          Cost is O(L * m^2) distance evaluations for L chords of m = 2n + 1 candidates.
+ */
+template<typename Dist = DistanceFuncRefPV>
+vector<PositionVector> optimalVoiceLeading(
+    const vector<PositionVector>& targets,
+    const vector<int>& complexities = vector<int>(),
+    Dist distFunc = manhattanDistance)
+{
+    if (targets.empty()) {
+        throw runtime_error("targets vector cannot be empty");
+    }
+    if (targets.size() == 1) {
+        return targets;
+    }
+    
+    size_t steps = targets.size() - 1;
+    vector<int> maxComplexities = complexities.empty()
+        ? vector<int>(steps, 100)
+        : normalizeComplexityVector(complexities, steps);
+    
+    // Candidate voicings, the first chord has only itself
+    vector<vector<PositionVector>> candidates(targets.size());
+    candidates[0].push_back(targets[0]);
+    for (size_t i = 1; i < targets.size(); ++i) {
+        PositionVector target = targets[i]; // Copy for rototranslationMatrix
+        candidates[i] = rototranslationMatrix(target, align(targets[0], target)).getVectors();
+    }
+    
+    const double unreachable = numeric_limits<double>::infinity();
+    vector<double> cost(1, 0.0);
+    vector<vector<size_t>> previous(targets.size());
+    vector<double> stepCost;
+    vector<size_t> order;
+    
+    for (size_t i = 1; i < targets.size(); ++i) {
+        const vector<PositionVector>& from = candidates[i - 1];
+        const vector<PositionVector>& to = candidates[i];
+        size_t allowed = complexityRank(maxComplexities[i - 1], to.size()) + 1;
+        
+        vector<double> nextCost(to.size(), unreachable);
+        previous[i].assign(to.size(), 0);
+        stepCost.resize(to.size());
+        order.resize(to.size());
+        
+        for (size_t p = 0; p < from.size(); ++p) {
+            if (cost[p] == unreachable) continue;
+            
+            for (size_t q = 0; q < to.size(); ++q) {
+                stepCost[q] = evaluateDistance(distFunc, from[p], to[q]);
+            }
+            
+            // The allowed voicings are the first `allowed` ones by (distance, index)
+            iota(order.begin(), order.end(), size_t(0));
+            if (allowed < to.size()) {
+                nth_element(order.begin(), order.begin() + (allowed - 1), order.end(),
+                    [&stepCost](size_t a, size_t b) {
+                        if (stepCost[a] != stepCost[b]) {
+                            return stepCost[a] < stepCost[b];
+                        }
+                        return a < b;
+                    });
+            }
+            
+            for (size_t k = 0; k < allowed; ++k) {
+                size_t q = order[k];
+                double total = cost[p] + stepCost[q];
+                if (total < nextCost[q]) {
+                    nextCost[q] = total;
+                    previous[i][q] = p;
+                }
+            }
+        }
+        cost = move(nextCost);
+    }
+    
+    // Backtrack from the cheapest last voicing
+    size_t best = static_cast<size_t>(min_element(cost.begin(), cost.end()) - cost.begin());
+    vector<PositionVector> result(targets.size());
+    for (size_t i = targets.size() - 1; i > 0; --i) {
+        result[i] = candidates[i][best];
+        best = previous[i][best];
+    }
+    result[0] = targets[0];
+    
+    return result;
+}
+
 /**
  * @brief Performs degree automation with a single reference position
  * @param scale The scale to use for modal selection
@@ -325,6 +510,37 @@ vector<PositionVector> degreeAutomationVectorReference(
     return result;
 }
 
+/**
+ * @brief Parallel degreeAutomationVectorReference
+ * @param pool Pool running the degrees, see parallel.h
+ * @param scale The scale to use for modal selection
+ * @param criterion The interval criterion for modal selection
+ * @param degrees Vector of degree values
+ * @param references Vector of reference PositionVectors (must match degrees size)
+ * @param complexities Vector of complexity values (will be normalized to match degrees size)
+ * @return Same vectors, in the same order, as the serial version
+ * @details Each degree builds its own modal rototranslation matrix as a task of the pool;
+ *          scale and criterion are only read.
+ */
+vector<PositionVector> degreeAutomationVectorReference(
+    ThreadPool& pool,
+    PositionVector& scale,
+    IntervalVector& criterion,
+    const vector<int>& degrees,
+    vector<PositionVector>& references,
+    const vector<int>& complexities = vector<int>())
+{
+    if (degrees.size() != references.size()) {
+        throw runtime_error("degrees and references must have the same size");
+    }
+    
+    vector<int> normalizedComplexities = normalizeComplexityVector(complexities, degrees.size());
+    
+    return pool.parallelMap(degrees.size(), [&](size_t i) {
+        return degreeAutomation(scale, criterion, degrees[i], references[i], normalizedComplexities[i]).getVector();
+    });
+}
+
 /**
  * @brief Performs sequential degree automation from start to end
  * @param scale The scale to use for modal selection
@@ -0,0 +1,407 @@
+#ifndef BATCH_DISTANCE_H
+#define BATCH_DISTANCE_H
+
+#include "./utility.h"
+#include <cstdint>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define VECTORS_BATCH_X86 1
+#include <immintrin.h>
+#endif
+
+/**
+ * @file batchDistance.h
+ * @brief Distances from one reference to many candidates stored contiguously
+ * @author [not251]
+ * @date 2025
+ * @details Candidates are count rows of length ints each, one after the other. Every
+ *          kernel writes one distance per row, equal to the matching function of
+ *          distances.h called as f(reference, candidate). On x86 with GCC or Clang the
+ *          kernels have SSE2, AVX2 and AVX-512 versions, selected once at run time from
+ *          the CPU features; every other target uses the scalar loops. No compiler flag
+ *          is needed, the vector code is enabled per function.
+ *
+ *          Euclidean sums are exact integers held in doubles, so the order of the
+ *          additions does not change the result while the sum stays below 2^53.
+ */
+
+/**
+ * @brief Instruction set used by the batch kernels
+ */
+enum class SimdLevel {
+    SCALAR,
+    SSE2,
+    AVX2,
+    AVX512
+};
+
+/**
+ * @brief Best instruction set supported by the running CPU
+ * @details Detected on first use and cached.
+ */
+inline SimdLevel detectSimdLevel() {
+    static const SimdLevel level = [] {
+#ifdef VECTORS_BATCH_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) return SimdLevel::AVX512;
+        if (__builtin_cpu_supports("avx2")) return SimdLevel::AVX2;
+        if (__builtin_cpu_supports("sse2")) return SimdLevel::SSE2;
+#endif
+        return SimdLevel::SCALAR;
+    }();
+    return level;
+}
+
+namespace batch_detail {
+
+// ==================== SCALAR ====================
+
+inline int manhattanRow(const int* a, const int* b, size_t n) {
+    int sum = 0;
+    for (size_t i = 0; i < n; ++i) sum += abs(a[i] - b[i]);
+    return sum;
+}
+
+inline double squaredRow(const int* a, const int* b, size_t n) {
+    double sum = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        double diff = a[i] - b[i];
+        sum += diff * diff;
+    }
+    return sum;
+}
+
+inline int hammingRow(const int* a, const int* b, size_t n) {
+    int count = 0;
+    for (size_t i = 0; i < n; ++i) count += a[i] != b[i];
+    return count;
+}
+
+inline int differenceRow(const int* a, const int* b, size_t n) {
+    int sum = 0;
+    for (size_t i = 0; i < n; ++i) sum += a[i] - b[i];
+    return sum;
+}
+
+#ifdef VECTORS_BATCH_X86
+
+// ==================== SSE2 ====================
+
+inline int hsum128(__m128i v) {
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(v);
+}
+
+inline __m128i abs128(__m128i v) {
+    // SSE2 has no abs_epi32
+    __m128i sign = _mm_srai_epi32(v, 31);
+    return _mm_sub_epi32(_mm_xor_si128(v, sign), sign);
+}
+
+inline int manhattanRowSse2(const int* a, const int* b, size_t n) {
+    __m128i acc = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i d = _mm_sub_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)),
+                                  _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i)));
+        acc = _mm_add_epi32(acc, abs128(d));
+    }
+    return hsum128(acc) + manhattanRow(a + i, b + i, n - i);
+}
+
+inline double squaredRowSse2(const int* a, const int* b, size_t n) {
+    __m128d acc = _mm_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i d = _mm_sub_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)),
+                                  _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i)));
+        __m128d lo = _mm_cvtepi32_pd(d);
+        __m128d hi = _mm_cvtepi32_pd(_mm_shuffle_epi32(d, _MM_SHUFFLE(1, 0, 3, 2)));
+        acc = _mm_add_pd(acc, _mm_add_pd(_mm_mul_pd(lo, lo), _mm_mul_pd(hi, hi)));
+    }
+    double lanes[2];
+    _mm_storeu_pd(lanes, acc);
+    return lanes[0] + lanes[1] + squaredRow(a + i, b + i, n - i);
+}
+
+inline int hammingRowSse2(const int* a, const int* b, size_t n) {
+    int count = 0;
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i eq = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)),
+                                     _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i)));
+        count += 4 - __builtin_popcount(static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(eq))));
+    }
+    return count + hammingRow(a + i, b + i, n - i);
+}
+
+inline int differenceRowSse2(const int* a, const int* b, size_t n) {
+    __m128i acc = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        acc = _mm_add_epi32(acc, _mm_sub_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)),
+                                               _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i))));
+    }
+    return hsum128(acc) + differenceRow(a + i, b + i, n - i);
+}
+
+// ==================== AVX2 ====================
+
+__attribute__((target("avx2"))) inline __m256i tailMask256(size_t remaining) {
+    // Lane j is active when j < remaining
+    __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    return _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(remaining)), lanes);
+}
+
+__attribute__((target("avx2"))) inline int hsum256(__m256i v) {
+    __m128i s = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(1, 0, 3, 2)));
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(s);
+}
+
+/**
+ * @brief Row difference a - b for lanes [i, i + 8), masked lanes read as zero
+ */
+__attribute__((target("avx2"))) inline __m256i diff256(const int* a, const int* b, size_t i, size_t n) {
+    if (i + 8 <= n) {
+        return _mm256_sub_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)),
+                                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i)));
+    }
+    __m256i mask = tailMask256(n - i);
+    return _mm256_sub_epi32(_mm256_maskload_epi32(a + i, mask), _mm256_maskload_epi32(b + i, mask));
+}
+
+__attribute__((target("avx2"))) inline int manhattanRowAvx2(const int* a, const int* b, size_t n) {
+    __m256i acc = _mm256_setzero_si256();
+    for (size_t i = 0; i < n; i += 8) {
+        acc = _mm256_add_epi32(acc, _mm256_abs_epi32(diff256(a, b, i, n)));
+    }
+    return hsum256(acc);
+}
+
+__attribute__((target("avx2"))) inline double hsum256d(__m256d v) {
+    __m128d s = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+}
+
+// Multiply and add rather than FMA: some CPUs and VMs report AVX2 without FMA.
+// The squares are exact integers, so the result is the same.
+__attribute__((target("avx2"))) inline double squaredRowAvx2(const int* a, const int* b, size_t n) {
+    __m256d acc = _mm256_setzero_pd();
+    for (size_t i = 0; i < n; i += 8) {
+        __m256i d = diff256(a, b, i, n);
+        __m256d lo = _mm256_cvtepi32_pd(_mm256_castsi256_si128(d));
+        __m256d hi = _mm256_cvtepi32_pd(_mm256_extracti128_si256(d, 1));
+        acc = _mm256_add_pd(acc, _mm256_mul_pd(lo, lo));
+        acc = _mm256_add_pd(acc, _mm256_mul_pd(hi, hi));
+    }
+    return hsum256d(acc);
+}
+
+__attribute__((target("avx2"))) inline int hammingRowAvx2(const int* a, const int* b, size_t n) {
+    int count = 0;
+    for (size_t i = 0; i < n; i += 8) {
+        // Masked lanes give a zero difference and are not counted
+        __m256i eq = _mm256_cmpeq_epi32(diff256(a, b, i, n), _mm256_setzero_si256());
+        count += 8 - __builtin_popcount(static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(eq))));
+    }
+    return count;
+}
+
+__attribute__((target("avx2"))) inline int differenceRowAvx2(const int* a, const int* b, size_t n) {
+    __m256i acc = _mm256_setzero_si256();
+    for (size_t i = 0; i < n; i += 8) {
+        acc = _mm256_add_epi32(acc, diff256(a, b, i, n));
+    }
+    return hsum256(acc);
+}
+
+// ==================== AVX-512 ====================
+
+/**
+ * @brief Row difference a - b for lanes [i, i + 16), masked lanes read as zero
+ */
+__attribute__((target("avx512f"))) inline __m512i diff512(const int* a, const int* b, size_t i, size_t n) {
+    size_t remaining = n - i;
+    __mmask16 mask = remaining >= 16 ? static_cast<__mmask16>(0xFFFF)
+                                     : static_cast<__mmask16>((1u << remaining) - 1);
+    return _mm512_sub_epi32(_mm512_maskz_loadu_epi32(mask, a + i), _mm512_maskz_loadu_epi32(mask, b + i));
+}
+
+// GCC 12 builds _mm512_reduce_add_*, _mm512_abs_epi32, _mm512_max_epi32, the
+// 512-to-256 casts and extracts and _mm512_cvtepi32_pd on an undefined register and
+// then reports it as uninitialized. The kernels use the zero-masked forms with a full
+// mask instead, and max(d, -d) for the absolute value.
+
+__attribute__((target("avx512f"))) inline __m256i low256(__m512i v) {
+    return _mm512_maskz_extracti64x4_epi64(0xF, v, 0);
+}
+
+__attribute__((target("avx512f"))) inline __m256i high256(__m512i v) {
+    return _mm512_maskz_extracti64x4_epi64(0xF, v, 1);
+}
+
+__attribute__((target("avx512f"))) inline int hsum512(__m512i v) {
+    return hsum256(_mm256_add_epi32(low256(v), high256(v)));
+}
+
+__attribute__((target("avx512f"))) inline double hsum512d(__m512d v) {
+    return hsum256d(_mm256_add_pd(_mm512_maskz_extractf64x4_pd(0xF, v, 0),
+                                  _mm512_maskz_extractf64x4_pd(0xF, v, 1)));
+}
+
+__attribute__((target("avx512f"))) inline int manhattanRowAvx512(const int* a, const int* b, size_t n) {
+    __m512i zero = _mm512_setzero_si512();
+    __m512i acc = zero;
+    for (size_t i = 0; i < n; i += 16) {
+        __m512i d = diff512(a, b, i, n);
+        acc = _mm512_add_epi32(acc, _mm512_maskz_max_epi32(0xFFFF, d, _mm512_sub_epi32(zero, d)));
+    }
+    return hsum512(acc);
+}
+
+__attribute__((target("avx512f"))) inline double squaredRowAvx512(const int* a, const int* b, size_t n) {
+    __m512d acc = _mm512_setzero_pd();
+    for (size_t i = 0; i < n; i += 16) {
+        __m512i d = diff512(a, b, i, n);
+        __m512d lo = _mm512_maskz_cvtepi32_pd(0xFF, low256(d));
+        __m512d hi = _mm512_maskz_cvtepi32_pd(0xFF, high256(d));
+        acc = _mm512_fmadd_pd(lo, lo, acc);
+        acc = _mm512_fmadd_pd(hi, hi, acc);
+    }
+    return hsum512d(acc);
+}
+
+__attribute__((target("avx512f"))) inline int hammingRowAvx512(const int* a, const int* b, size_t n) {
+    int count = 0;
+    for (size_t i = 0; i < n; i += 16) {
+        __mmask16 ne = _mm512_cmpneq_epi32_mask(diff512(a, b, i, n), _mm512_setzero_si512());
+        count += __builtin_popcount(static_cast<unsigned>(ne));
+    }
+    return count;
+}
+
+__attribute__((target("avx512f"))) inline int differenceRowAvx512(const int* a, const int* b, size_t n) {
+    __m512i acc = _mm512_setzero_si512();
+    for (size_t i = 0; i < n; i += 16) {
+        acc = _mm512_add_epi32(acc, diff512(a, b, i, n));
+    }
+    return hsum512(acc);
+}
+
+#endif // VECTORS_BATCH_X86
+
+/**
+ * @brief Applies a row kernel to every candidate
+ * @details One copy per instruction set, so that the row kernel is inlined in the loop.
+ */
+template<typename Out, Out (*Row)(const int*, const int*, size_t)>
+void forEachRow(const int* reference, const int* candidates, size_t length, size_t count, Out* out) {
+    for (size_t c = 0; c < count; ++c) {
+        out[c] = Row(reference, candidates + c * length, length);
+    }
+}
+
+#ifdef VECTORS_BATCH_X86
+
+template<typename Out, Out (*Row)(const int*, const int*, size_t)>
+__attribute__((target("avx2")))
+void forEachRowAvx2(const int* reference, const int* candidates, size_t length, size_t count, Out* out) {
+    for (size_t c = 0; c < count; ++c) {
+        out[c] = Row(reference, candidates + c * length, length);
+    }
+}
+
+template<typename Out, Out (*Row)(const int*, const int*, size_t)>
+__attribute__((target("avx512f")))
+void forEachRowAvx512(const int* reference, const int* candidates, size_t length, size_t count, Out* out) {
+    for (size_t c = 0; c < count; ++c) {
+        out[c] = Row(reference, candidates + c * length, length);
+    }
+}
+
+#endif // VECTORS_BATCH_X86
+
+} // namespace batch_detail
+
+// ==================== BATCH KERNELS ====================
+
+/**
+ * @brief Manhattan distances from a reference to count candidates
+ * @param reference length values
+ * @param candidates count * length values, candidate c at candidates + c * length
+ * @param length Number of values per vector
+ * @param count Number of candidates
+ * @param out Receives count distances
+ * @param level Instruction set, default the best supported one (must be supported)
+ */
+inline void batchManhattanDistance(const int* reference, const int* candidates, size_t length,
+                                   size_t count, int* out, SimdLevel level = detectSimdLevel()) {
+    using namespace batch_detail;
+    switch (level) {
+#ifdef VECTORS_BATCH_X86
+        case SimdLevel::AVX512: return forEachRowAvx512<int, manhattanRowAvx512>(reference, candidates, length, count, out);
+        case SimdLevel::AVX2: return forEachRowAvx2<int, manhattanRowAvx2>(reference, candidates, length, count, out);
+        case SimdLevel::SSE2: return forEachRow<int, manhattanRowSse2>(reference, candidates, length, count, out);
+#endif
+        default: return forEachRow<int, manhattanRow>(reference, candidates, length, count, out);
+    }
+}
+
+/**
+ * @brief Euclidean distances from a reference to count candidates
+ * @see batchManhattanDistance
+ */
+inline void batchEuclideanDistance(const int* reference, const int* candidates, size_t length,
+                                   size_t count, double* out, SimdLevel level = detectSimdLevel()) {
+    using namespace batch_detail;
+    switch (level) {
+#ifdef VECTORS_BATCH_X86
+        case SimdLevel::AVX512: forEachRowAvx512<double, squaredRowAvx512>(reference, candidates, length, count, out); break;
+        case SimdLevel::AVX2: forEachRowAvx2<double, squaredRowAvx2>(reference, candidates, length, count, out); break;
+        case SimdLevel::SSE2: forEachRow<double, squaredRowSse2>(reference, candidates, length, count, out); break;
+#endif
+        default: forEachRow<double, squaredRow>(reference, candidates, length, count, out); break;
+    }
+    for (size_t c = 0; c < count; ++c) {
+        out[c] = sqrt(out[c]);
+    }
+}
+
+/**
+ * @brief Hamming distances (number of differing positions) from a reference to count candidates
+ * @see batchManhattanDistance
+ */
+inline void batchHammingDistance(const int* reference, const int* candidates, size_t length,
+                                 size_t count, int* out, SimdLevel level = detectSimdLevel()) {
+    using namespace batch_detail;
+    switch (level) {
+#ifdef VECTORS_BATCH_X86
+        case SimdLevel::AVX512: return forEachRowAvx512<int, hammingRowAvx512>(reference, candidates, length, count, out);
+        case SimdLevel::AVX2: return forEachRowAvx2<int, hammingRowAvx2>(reference, candidates, length, count, out);
+        case SimdLevel::SSE2: return forEachRow<int, hammingRowSse2>(reference, candidates, length, count, out);
+#endif
+        default: return forEachRow<int, hammingRow>(reference, candidates, length, count, out);
+    }
+}
+
+/**
+ * @brief Sums of reference - candidate from a reference to count candidates
+ * @see batchManhattanDistance
+ */
+inline void batchDifference(const int* reference, const int* candidates, size_t length,
+                            size_t count, int* out, SimdLevel level = detectSimdLevel()) {
+    using namespace batch_detail;
+    switch (level) {
+#ifdef VECTORS_BATCH_X86
+        case SimdLevel::AVX512: return forEachRowAvx512<int, differenceRowAvx512>(reference, candidates, length, count, out);
+        case SimdLevel::AVX2: return forEachRowAvx2<int, differenceRowAvx2>(reference, candidates, length, count, out);
+        case SimdLevel::SSE2: return forEachRow<int, differenceRowSse2>(reference, candidates, length, count, out);
+#endif
+        default: return forEachRow<int, differenceRow>(reference, candidates, length, count, out);
+    }
+}
+
+#endif // BATCH_DISTANCE_H
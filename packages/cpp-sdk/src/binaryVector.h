@@ -2,6 +2,7 @@
 #define BINARYVECTOR_H
 
 #include "./mathUtil.h"
+#include "./bitUtil.h"
 
 using namespace std;
 
@@ -24,19 +25,195 @@ using namespace std;
  * - Complement and inversion operations
  * - Logical operations (OR, AND, XOR, NOR, NAND, XNOR)
  * - Automatic modulo adaptation via LCM
+ *
+ * Steps are stored bit-packed in 64-bit words, so logical operations, rotation,
+ * complement and pulse counting run one machine word at a time.
  */
 class BinaryVector {
+private:
+    vector<uint64_t> words_; ///< Packed binary data, step i is bit (i % 64) of word (i / 64)
+    size_t length_;          ///< Number of steps in the pattern
+
+    /**
+     * @brief Builds a BinaryVector directly from packed words
+     * @param words Packed words (bits past length are cleared)
+     * @param length Number of steps
+     * @param offset Offset value
+     * @param mod Modulo base
+     * @return New BinaryVector sharing no storage with the caller
+     */
+    static BinaryVector fromWords(vector<uint64_t> words, size_t length, int offset, int mod) {
+        BinaryVector result(vector<int>(), offset, mod);
+        result.words_ = move(words);
+        result.words_.resize(wordsForBits(length), 0);
+        result.length_ = length;
+        result.clearTail();
+        return result;
+    }
+
+    /**
+     * @brief Clears the unused bits of the last word
+     * @details Every word-level operation relies on the bits past length being zero.
+     */
+    void clearTail() {
+        size_t used = length_ % WORD_BITS;
+        if (used != 0 && !words_.empty()) {
+            words_.back() &= lowMask64(used);
+        }
+    }
+
+    /**
+     * @brief Sets step i to 1
+     */
+    void setBit(size_t i) {
+        words_[i / WORD_BITS] |= 1ULL << (i % WORD_BITS);
+    }
+
+    /**
+     * @brief Reads step i without cyclic wrapping
+     */
+    int bit(size_t i) const {
+        return static_cast<int>((words_[i / WORD_BITS] >> (i % WORD_BITS)) & 1ULL);
+    }
+
+    /**
+     * @brief Reads count consecutive steps starting at pos
+     * @param pos First step (pos + count must not exceed the length)
+     * @param count Number of steps (1 to 64)
+     * @return Steps packed in the low bits of a word
+     */
+    uint64_t extractBits(size_t pos, size_t count) const {
+        size_t w = pos / WORD_BITS;
+        size_t b = pos % WORD_BITS;
+        uint64_t value = words_[w] >> b;
+        if (b != 0 && b + count > WORD_BITS) {
+            value |= words_[w + 1] << (WORD_BITS - b);
+        }
+        return value & lowMask64(count);
+    }
+
+    /**
+     * @brief Reads 64 steps starting at start, wrapping around the pattern
+     * @param start First step, in [0, length)
+     * @return Word whose bit k is step (start + k) mod length
+     */
+    uint64_t cyclicWord(size_t start) const {
+        uint64_t value = 0;
+        size_t filled = 0;
+        size_t pos = start;
+        while (filled < WORD_BITS) {
+            size_t take = min(WORD_BITS - filled, length_ - pos);
+            value |= extractBits(pos, take) << filled;
+            filled += take;
+            pos += take;
+            if (pos == length_) pos = 0;
+        }
+        return value;
+    }
+
+    /**
+     * @brief Packs the pattern cyclically repeated up to n steps
+     * @param n Target length (at least the current length)
+     * @return Packed words of the tiled pattern
+     */
+    vector<uint64_t> tiledWords(size_t n) const {
+        if (n == length_) {
+            return words_;
+        }
+        vector<uint64_t> out(wordsForBits(n), 0);
+        for (size_t w = 0; w < out.size(); ++w) {
+            out[w] = cyclicWord((w * WORD_BITS) % length_);
+        }
+        if (n % WORD_BITS != 0) {
+            out.back() &= lowMask64(n % WORD_BITS);
+        }
+        return out;
+    }
+
+    /**
+     * @brief Appends count steps taken from the low bits of a word
+     * @param bits Steps to append
+     * @param count Number of steps (0 to 64)
+     */
+    void appendBits(uint64_t bits, size_t count) {
+        if (count == 0) return;
+        bits &= lowMask64(count);
+        size_t w = length_ / WORD_BITS;
+        size_t b = length_ % WORD_BITS;
+        words_.resize(wordsForBits(length_ + count), 0);
+        words_[w] |= bits << b;
+        if (b != 0 && b + count > WORD_BITS) {
+            words_[w + 1] |= bits >> (WORD_BITS - b);
+        }
+        length_ += count;
+    }
+
+    /**
+     * @brief Appends all steps of another pattern
+     */
+    void appendPattern(const BinaryVector& other) {
+        size_t remaining = other.length_;
+        for (size_t w = 0; w < other.words_.size(); ++w) {
+            size_t count = min(WORD_BITS, remaining);
+            appendBits(other.words_[w], count);
+            remaining -= count;
+        }
+    }
+
+    /**
+     * @brief Word-parallel componentwise combination
+     * @param other Pattern to combine with
+     * @param useLooping If true, the shorter pattern wraps cyclically; if false, the tail of the longer one is copied
+     * @param op Word operation (OR, AND, XOR)
+     * @return New BinaryVector with the operation applied
+     */
+    template<typename Op>
+    BinaryVector combine(const BinaryVector& other, bool useLooping, Op op) const {
+        size_t n = max(length_, other.length_);
+
+        if (useLooping) {
+            vector<uint64_t> a = tiledWords(n);
+            vector<uint64_t> b = other.tiledWords(n);
+            for (size_t w = 0; w < a.size(); ++w) {
+                a[w] = op(a[w], b[w]);
+            }
+            return fromWords(move(a), n, offset, mod);
+        }
+
+        size_t minLength = min(length_, other.length_);
+        const vector<uint64_t>& longer = length_ >= other.length_ ? words_ : other.words_;
+        vector<uint64_t> result(wordsForBits(n), 0);
+
+        for (size_t w = 0; w < result.size(); ++w) {
+            size_t lo = w * WORD_BITS;
+            if (lo >= minLength) {
+                result[w] = longer[w];
+                continue;
+            }
+            uint64_t a = w < words_.size() ? words_[w] : 0;
+            uint64_t b = w < other.words_.size() ? other.words_[w] : 0;
+            uint64_t combined = op(a, b);
+            if (lo + WORD_BITS <= minLength) {
+                result[w] = combined;
+            } else {
+                uint64_t mask = lowMask64(minLength - lo);
+                result[w] = (combined & mask) | (longer[w] & ~mask);
+            }
+        }
+        return fromWords(move(result), n, offset, mod);
+    }
+
 public:
-    vector<int> data;        ///< Binary data (0s and 1s)
     int offset;              ///< Offset for transposition
     int mod;                 ///< Modulo base (period)
 
     /**
      * @brief Validates that data contains only 0s and 1s
+     * @param values Values to check
      * @throw invalid_argument if data contains invalid values
      */
-    void validateBinaryData() const {
-        for (int val : data) {
+    static void validateBinaryData(const vector<int>& values) {
+        for (int val : values) {
             if (val != 0 && val != 1) {
                 throw invalid_argument("BinaryVector data must contain only 0s and 1s");
             }
@@ -48,9 +225,7 @@ public:
      * @brief Default constructor
      */
     BinaryVector() 
-        : data({1, 0, 0, 0}), 
-          offset(0),
-          mod(4)
+        : BinaryVector({1, 0, 0, 0}, 0, 4)
     {}
 
     /**
@@ -63,19 +238,34 @@ public:
     BinaryVector(const vector<int>& data, 
                  int offset = 0,
                  int mod = 4)
-        : data(data), 
+        : words_(wordsForBits(data.size()), 0),
+          length_(data.size()),
           offset(offset),
           mod(mod)
     {
-        validateBinaryData();
+        validateBinaryData(data);
+        for (size_t i = 0; i < data.size(); ++i) {
+            if (data[i] == 1) setBit(i);
+        }
     }
 
     // ==================== GETTERS ====================
 
-    const vector<int>& getData() const { return data; }
+    /**
+     * @brief Unpacks the pattern into one int (0 or 1) per step
+     * @return Unpacked binary data
+     */
+    vector<int> getData() const {
+        vector<int> out(length_);
+        for (size_t i = 0; i < length_; ++i) {
+            out[i] = bit(i);
+        }
+        return out;
+    }
+    const vector<uint64_t>& getWords() const { return words_; }
     int getOffset() const { return offset; }
     int getMod() const { return mod; }
-    size_t size() const { return data.size(); }
+    size_t size() const { return length_; }
 
     // ==================== SETTERS ====================
 
@@ -95,23 +285,18 @@ public:
      * @return New BinaryVector with elements spaced by zeros
      * @details Elements are spaced out by inserting (scalar-1) zeros between each element
      */
-    BinaryVector operator*(int scalar) const { // v: vettore in ingresso, k: scalare positivo
-    if (scalar <= 0) {
-        throw invalid_argument("scalar must be positive"); // controllo che k sia positivo
-    }
-    
-    int n = data.size(); // lunghezza del vettore in ingresso
-    vector<int> out(scalar * n, 0); // inizializzo un vettore di zeri lungo kn
-    
-    for (int i = 0; i < scalar * n; i++) { // per ogni intero da 0 a kn
-        if ((i + 1) % scalar == 1) { // se l'indice successivo è congruente a 1 modulo k
-            int index = i / scalar; // inizializzo l'indice di selezione a i/k
-            out[i] = data[index]; // metto alla i-esima posizione del vettore in uscita l'elemento alla i/k-esima posizione del vettore in ingresso
+    BinaryVector operator*(int scalar) const {
+        if (scalar <= 0) {
+            throw invalid_argument("scalar must be positive");
         }
+
+        size_t n = length_ * static_cast<size_t>(scalar);
+        BinaryVector result = fromWords(vector<uint64_t>(), n, offset, mod);
+        for (int index : getPulseIndices()) {
+            result.setBit(static_cast<size_t>(index) * scalar);
+        }
+        return result;
     }
-    
-    return BinaryVector(out, offset, mod); // restituisco il vettore 'moltiplicato'
-}
 
 
  /**
@@ -122,28 +307,29 @@ public:
  * For each gap between pulses, keeps only 1/divisor of the zeros (rounded down).
  * This is the inverse operation of multiplication.
  */
-BinaryVector operator/(int scalar) const { // v: vettore in ingresso, k: scalare positivo
-    int n = data.size(); // lunghezza del vettore in ingresso
+BinaryVector operator/(int scalar) const {
+    int n = static_cast<int>(length_);
 
     if (scalar <= 0) {
-        throw invalid_argument("k must be positive"); // controllo che k sia positivo
+        throw invalid_argument("k must be positive");
     }
     
     if (scalar > n) {
-        throw invalid_argument("k must be less than or equal to vector size"); // controllo che k sia minore o uguale a n
+        throw invalid_argument("k must be less than or equal to vector size");
     }
     
     
     if (n % scalar != 0) {
-        throw invalid_argument("Vector size must be divisible by k"); // controllo che n sia divisibile per k
+        throw invalid_argument("Vector size must be divisible by k");
     }
     
-    vector<int> out(n / scalar); // inizializzo un vettore di zeri lungo n/k
-    for (int i = 0; i < n / scalar; i++) { // per ogni intero da 0 a n/k
-        int index = i * scalar; // inizializzo l'indice di selezione a ik
-        out[i] = data[index]; // metto alla i-esima posizione del vettore in uscita l'elemento alla ik-esima posizione del vettore in ingresso
+    BinaryVector result = fromWords(vector<uint64_t>(), n / scalar, offset, mod);
+    for (int i = 0; i < n / scalar; i++) {
+        if (bit(static_cast<size_t>(i) * scalar)) {
+            result.setBit(i);
+        }
     }
-    return BinaryVector(out, offset, mod); // restituisco il vettore 'diviso'
+    return result;
 }
 
     BinaryVector& operator*=(int scalar) {
@@ -168,8 +354,8 @@ BinaryVector divide(int divisor) const {
     vector<int> compressed;
     int consecutiveZeros = 0;
     
-    for (size_t i = 0; i < data.size(); ++i) {
-        if (data[i] == 1) {
+    for (size_t i = 0; i < length_; ++i) {
+        if (bit(i) == 1) {
             // Output compressed zeros before this pulse
             int compressedZeroCount = consecutiveZeros / divisor;
             for (int j = 0; j < compressedZeroCount; ++j) {
@@ -190,13 +376,13 @@ BinaryVector divide(int divisor) const {
     }
     
     // Pad with zeros to maintain original length
-    while (compressed.size() < data.size()) {
+    while (compressed.size() < length_) {
         compressed.emplace_back(0);
     }
     
     // Truncate if somehow longer (shouldn't happen, but safety check)
-    if (compressed.size() > data.size()) {
-        compressed.resize(data.size());
+    if (compressed.size() > length_) {
+        compressed.resize(length_);
     }
     
     return BinaryVector(compressed, offset, mod);
@@ -209,142 +395,59 @@ BinaryVector divide(int divisor) const {
             throw invalid_argument("Scalar must be positive for multiplication");
         }
 
-        vector<int> result;
-        result.reserve(data.size() * scalar);
-
-        for (int val : data) {
-            result.emplace_back(val);
-            for (int i = 1; i < scalar; ++i) {
-                result.emplace_back(0);
-            }
-        }
-
-        return BinaryVector(result, offset, mod * scalar);
+        BinaryVector result = *this * scalar;
+        result.mod = mod * scalar;
+        return result;
     }
     
     // ==================== COMPONENTWISE LOGICAL OPERATIONS ====================
 
     /**
      * @brief Componentwise OR with optional looping
-     * @param other Vector to OR with
+     * @param other Pattern to OR with
      * @param useLooping If true, use cyclic wraparound; if false, extend with unprocessed elements
      * @return New BinaryVector with OR operation applied
      */
+    BinaryVector componentwiseOr(const BinaryVector& other, bool useLooping = false) const {
+        if (other.length_ == 0) return *this;
+        if (length_ == 0) return fromWords(other.words_, other.length_, offset, mod);
+        return combine(other, useLooping, [](uint64_t a, uint64_t b) { return a | b; });
+    }
+
     BinaryVector componentwiseOr(const vector<int>& other, bool useLooping = false) const {
-        if (other.empty()) return *this;
-        if (data.empty()) return BinaryVector(other, offset, mod);
-        
-        vector<int> result;
-        
-        if (useLooping) {
-            size_t maxLength = max(data.size(), other.size());
-            result.reserve(maxLength);
-            
-            for (size_t i = 0; i < maxLength; ++i) {
-                int val1 = data[i % data.size()];
-                int val2 = other[i % other.size()];
-                result.emplace_back(val1 | val2);
-            }
-        } else {
-            size_t minLength = min(data.size(), other.size());
-            result.reserve(max(data.size(), other.size()));
-            
-            for (size_t i = 0; i < minLength; ++i) {
-                result.emplace_back(data[i] | other[i]);
-            }
-            
-            for (size_t i = minLength; i < data.size(); ++i) {
-                result.emplace_back(data[i]);
-            }
-            
-            for (size_t i = minLength; i < other.size(); ++i) {
-                result.emplace_back(other[i]);
-            }
-        }
-        
-        return BinaryVector(result, offset, mod);
+        return componentwiseOr(BinaryVector(other, offset, mod), useLooping);
     }
 
     /**
      * @brief Componentwise AND with optional looping
-     * @param other Vector to AND with
+     * @param other Pattern to AND with
      * @param useLooping If true, use cyclic wraparound; if false, extend with unprocessed elements
      * @return New BinaryVector with AND operation applied
      */
+    BinaryVector componentwiseAnd(const BinaryVector& other, bool useLooping = false) const {
+        if (other.length_ == 0) return BinaryVector({}, offset, mod);
+        if (length_ == 0) return *this;
+        return combine(other, useLooping, [](uint64_t a, uint64_t b) { return a & b; });
+    }
+
     BinaryVector componentwiseAnd(const vector<int>& other, bool useLooping = false) const {
-        if (other.empty()) return BinaryVector({}, offset, mod);
-        if (data.empty()) return *this;
-        
-        vector<int> result;
-        
-        if (useLooping) {
-            size_t maxLength = max(data.size(), other.size());
-            result.reserve(maxLength);
-            
-            for (size_t i = 0; i < maxLength; ++i) {
-                int val1 = data[i % data.size()];
-                int val2 = other[i % other.size()];
-                result.emplace_back(val1 & val2);
-            }
-        } else {
-            size_t minLength = min(data.size(), other.size());
-            result.reserve(max(data.size(), other.size()));
-            
-            for (size_t i = 0; i < minLength; ++i) {
-                result.emplace_back(data[i] & other[i]);
-            }
-            
-            for (size_t i = minLength; i < data.size(); ++i) {
-                result.emplace_back(data[i]);
-            }
-            
-            for (size_t i = minLength; i < other.size(); ++i) {
-                result.emplace_back(other[i]);
-            }
-        }
-        
-        return BinaryVector(result, offset, mod);
+        return componentwiseAnd(BinaryVector(other, offset, mod), useLooping);
     }
 
     /**
      * @brief Componentwise XOR with optional looping
-     * @param other Vector to XOR with
+     * @param other Pattern to XOR with
      * @param useLooping If true, use cyclic wraparound; if false, extend with unprocessed elements
      * @return New BinaryVector with XOR operation applied
      */
+    BinaryVector componentwiseXor(const BinaryVector& other, bool useLooping = false) const {
+        if (other.length_ == 0) return *this;
+        if (length_ == 0) return fromWords(other.words_, other.length_, offset, mod);
+        return combine(other, useLooping, [](uint64_t a, uint64_t b) { return a ^ b; });
+    }
+
     BinaryVector componentwiseXor(const vector<int>& other, bool useLooping = false) const {
-        if (other.empty()) return *this;
-        if (data.empty()) return BinaryVector(other, offset, mod);
-        
-        vector<int> result;
-        
-        if (useLooping) {
-            size_t maxLength = max(data.size(), other.size());
-            result.reserve(maxLength);
-            
-            for (size_t i = 0; i < maxLength; ++i) {
-                int val1 = data[i % data.size()];
-                int val2 = other[i % other.size()];
-                result.emplace_back(val1 ^ val2);
-            }
-        } else {
-            size_t minLength = min(data.size(), other.size());
-            result.reserve(max(data.size(), other.size()));
-            
-            for (size_t i = 0; i < minLength; ++i) {
-                result.emplace_back(data[i] ^ other[i]);
-            }
-            
-            for (size_t i = minLength; i < data.size(); ++i) {
-                result.emplace_back(data[i]);
-            }
-            
-            for (size_t i = minLength; i < other.size(); ++i) {
-                result.emplace_back(other[i]);
-            }
-        }
-        
-        return BinaryVector(result, offset, mod);
+        return componentwiseXor(BinaryVector(other, offset, mod), useLooping);
     }
 
     // ==================== LOGICAL OPERATIONS (LCM-ADAPTED) ====================
@@ -356,8 +459,11 @@ BinaryVector divide(int divisor) const {
      * @details Combines patterns - pulse occurs if either source has a pulse
      */
     BinaryVector operator|(const BinaryVector& other) const {
+        if (mod == other.mod) {
+            return componentwiseOr(other, false);
+        }
         vector<BinaryVector> adapted = adaptToLCM({*this, other});
-        return adapted[0].componentwiseOr(adapted[1].data, false);
+        return adapted[0].componentwiseOr(adapted[1], false);
     }
 
     /**
@@ -367,8 +473,11 @@ BinaryVector divide(int divisor) const {
      * @details Creates sparse pattern - pulse only where both sources pulse
      */
     BinaryVector operator&(const BinaryVector& other) const {
+        if (mod == other.mod) {
+            return componentwiseAnd(other, false);
+        }
         vector<BinaryVector> adapted = adaptToLCM({*this, other});
-        return adapted[0].componentwiseAnd(adapted[1].data, false);
+        return adapted[0].componentwiseAnd(adapted[1], false);
     }
 
     /**
@@ -378,8 +487,11 @@ BinaryVector divide(int divisor) const {
      * @details Creates counter-rhythm - pulse where patterns don't coincide
      */
     BinaryVector operator^(const BinaryVector& other) const {
+        if (mod == other.mod) {
+            return componentwiseXor(other, false);
+        }
         vector<BinaryVector> adapted = adaptToLCM({*this, other});
-        return adapted[0].componentwiseXor(adapted[1].data, false);
+        return adapted[0].componentwiseXor(adapted[1], false);
     }
 
     /**
@@ -446,14 +558,15 @@ BinaryVector divide(int divisor) const {
      * @return Value at index with cyclic behavior
      */
     int operator[](int index) const {
-        if (data.empty()) return 0;
-        int size = static_cast<int>(data.size());
+        if (length_ == 0) return 0;
+        int size = static_cast<int>(length_);
         DivisionResult div = euclideanDivision(index, size);
-        return data[div.remainder];
+        return bit(div.remainder);
     }
 
     bool operator==(const BinaryVector& other) const {
-        return data == other.data && offset == other.offset && mod == other.mod;
+        return length_ == other.length_ && words_ == other.words_ &&
+               offset == other.offset && mod == other.mod;
     }
 
     bool operator!=(const BinaryVector& other) const {
@@ -468,9 +581,9 @@ BinaryVector divide(int divisor) const {
 
     friend ostream& operator<<(ostream& os, const BinaryVector& bv) {
         os << "[";
-        for (size_t i = 0; i < bv.data.size(); ++i) {
-            os << bv.data[i];
-            if (i < bv.data.size() - 1) os << ", ";
+        for (size_t i = 0; i < bv.length_; ++i) {
+            os << bv.bit(i);
+            if (i < bv.length_ - 1) os << ", ";
         }
         os << "] (offset: " << bv.offset << ")";
         return os;
@@ -508,18 +621,9 @@ BinaryVector divide(int divisor) const {
             int scaleFactor = lcm / bv.mod;
             
             // Space out elements by inserting zeros
-            vector<int> spacedData;
-            spacedData.reserve(bv.data.size() * scaleFactor);
-
-            for (int val : bv.data) {
-                spacedData.emplace_back(val);
-                for (int i = 1; i < scaleFactor; ++i) {
-                    spacedData.emplace_back(0);
-                }
-            }
-
-            BinaryVector adaptedBV(spacedData, bv.offset, lcm);
-            adaptedVectors.emplace_back(adaptedBV);
+            BinaryVector adaptedBV = bv * scaleFactor;
+            adaptedBV.mod = lcm;
+            adaptedVectors.emplace_back(move(adaptedBV));
         }
 
         return adaptedVectors;
@@ -578,22 +682,26 @@ BinaryVector divide(int divisor) const {
      * @brief Rotate the pattern cyclically
      * @param rotationAmount Amount to rotate (positive or negative)
      * @return New BinaryVector with rotated pattern
+     * @details Each output word is read with a single cyclic window over the packed data.
      */
     BinaryVector rotate(int rotationAmount) const {
-        if (data.empty()) {
+        if (length_ == 0) {
             return *this;
         }
 
-        int size = static_cast<int>(data.size());
+        int size = static_cast<int>(length_);
         DivisionResult div = euclideanDivision(rotationAmount, size);
-        int normalizedRotation = div.remainder;
+        size_t normalizedRotation = div.remainder;
+        if (normalizedRotation == 0) {
+            return *this;
+        }
 
-        vector<int> rotatedData(size);
-        for (int i = 0; i < size; ++i) {
-            rotatedData[i] = data[(i + normalizedRotation) % size];
+        vector<uint64_t> rotatedWords(words_.size());
+        for (size_t w = 0; w < rotatedWords.size(); ++w) {
+            rotatedWords[w] = cyclicWord((w * WORD_BITS + normalizedRotation) % length_);
         }
 
-        return BinaryVector(rotatedData, offset, mod);
+        return fromWords(move(rotatedWords), length_, offset, mod);
     }
 
     /**
@@ -601,11 +709,11 @@ BinaryVector divide(int divisor) const {
      * @return New BinaryVector with inverted bits
      */
     BinaryVector complement() const {
-        vector<int> complementData(data.size());
-        for (size_t i = 0; i < data.size(); ++i) {
-            complementData[i] = 1 - data[i];
+        vector<uint64_t> complementWords(words_.size());
+        for (size_t w = 0; w < words_.size(); ++w) {
+            complementWords[w] = ~words_[w];
         }
-        return BinaryVector(complementData, offset, mod);
+        return fromWords(move(complementWords), length_, offset, mod);
     }
 
     /**
@@ -614,23 +722,25 @@ BinaryVector divide(int divisor) const {
      * @return New BinaryVector with pattern inverted around axis
      */
     BinaryVector inversion(int axisIndex) const {
-        if (data.empty()) {
+        if (length_ == 0) {
             return *this;
         }
 
-        int size = static_cast<int>(data.size());
+        int size = static_cast<int>(length_);
         DivisionResult div = euclideanDivision(axisIndex, size);
         int normalizedAxis = div.remainder;
 
-        vector<int> invertedData(size);
+        BinaryVector result = fromWords(vector<uint64_t>(), length_, offset, mod);
         for (int i = 0; i < size; ++i) {
             int distance = i - normalizedAxis;
             int mirrorIndex = normalizedAxis - distance;
             DivisionResult mirrorDiv = euclideanDivision(mirrorIndex, size);
-            invertedData[i] = data[mirrorDiv.remainder];
+            if (bit(mirrorDiv.remainder)) {
+                result.setBit(i);
+            }
         }
 
-        return BinaryVector(invertedData, offset, mod);
+        return result;
     }
 
     /**
@@ -639,7 +749,9 @@ BinaryVector divide(int divisor) const {
      * @return New BinaryVector with updated offset
      */
     BinaryVector transpose(int transpositionAmount) const {
-        return BinaryVector(data, offset + transpositionAmount, mod);
+        BinaryVector result(*this);
+        result.offset = offset + transpositionAmount;
+        return result;
     }
 
     // ==================== UTILITY METHODS ====================
@@ -650,9 +762,9 @@ BinaryVector divide(int divisor) const {
      * @return New BinaryVector with concatenated data
      */
     BinaryVector concatenate(const BinaryVector& other) const {
-        vector<int> result = data;
-        result.insert(result.end(), other.data.begin(), other.data.end());
-        return BinaryVector(result, offset, mod);
+        BinaryVector result(*this);
+        result.appendPattern(other);
+        return result;
     }
 
     /**
@@ -665,14 +777,14 @@ BinaryVector divide(int divisor) const {
             return BinaryVector({}, offset, mod);
         }
 
-        vector<int> result;
-        result.reserve(data.size() * times);
+        BinaryVector result = fromWords(vector<uint64_t>(), 0, offset, mod);
+        result.words_.reserve(wordsForBits(length_ * times));
 
         for (int t = 0; t < times; ++t) {
-            result.insert(result.end(), data.begin(), data.end());
+            result.appendPattern(*this);
         }
 
-        return BinaryVector(result, offset, mod);
+        return result;
     }
 
     /**
@@ -680,7 +792,11 @@ BinaryVector divide(int divisor) const {
      * @return Number of 1s in the pattern
      */
     int countPulses() const {
-        return count(data.begin(), data.end(), 1);
+        int count = 0;
+        for (uint64_t word : words_) {
+            count += popcount64(word);
+        }
+        return count;
     }
 
     /**
@@ -688,19 +804,23 @@ BinaryVector divide(int divisor) const {
      * @return Density value between 0 and 1
      */
     double density() const {
-        if (data.empty()) return 0.0;
-        return static_cast<double>(countPulses()) / data.size();
+        if (length_ == 0) return 0.0;
+        return static_cast<double>(countPulses()) / length_;
     }
 
     /**
      * @brief Extract indices where pulses occur
      * @return Vector of indices containing 1s
+     * @details Scans set bits word by word, skipping runs of rests.
      */
     vector<int> getPulseIndices() const {
         vector<int> indices;
-        for (size_t i = 0; i < data.size(); ++i) {
-            if (data[i] == 1) {
-                indices.emplace_back(static_cast<int>(i));
+        indices.reserve(countPulses());
+        for (size_t w = 0; w < words_.size(); ++w) {
+            uint64_t word = words_[w];
+            while (word) {
+                indices.emplace_back(static_cast<int>(w * WORD_BITS + ctz64(word)));
+                word &= word - 1;
             }
         }
         return indices;
@@ -722,7 +842,7 @@ BinaryVector divide(int divisor) const {
         }
         
         // Add wraparound interval
-        intervals.emplace_back(static_cast<int>(data.size()) - indices.back() + indices[0]);
+        intervals.emplace_back(static_cast<int>(length_) - indices.back() + indices[0]);
         
         return intervals;
     }
@@ -731,9 +851,9 @@ BinaryVector divide(int divisor) const {
 
     void printData() const {
         cout << "Data: [";
-        for (size_t i = 0; i < data.size(); ++i) {
-            cout << data[i];
-            if (i < data.size() - 1) cout << ", ";
+        for (size_t i = 0; i < length_; ++i) {
+            cout << bit(i);
+            if (i < length_ - 1) cout << ", ";
         }
         cout << "]" << endl;
     }
@@ -743,14 +863,14 @@ BinaryVector divide(int divisor) const {
         printData();
         cout << "Offset: " << offset << endl;
         cout << "Mod: " << mod << endl;
-        cout << "Size: " << data.size() << endl;
+        cout << "Size: " << length_ << endl;
         cout << "Pulses: " << countPulses() << endl;
         cout << "Density: " << density() << endl;
     }
 
     void printPattern() const {
-        for (size_t i = 0; i < data.size(); ++i) {
-            cout << (data[i] == 1 ? "X" : ".");
+        for (size_t i = 0; i < length_; ++i) {
+            cout << (bit(i) == 1 ? "X" : ".");
         }
         cout << endl;
     }
@@ -0,0 +1,100 @@
+#ifndef BITUTIL_H
+#define BITUTIL_H
+
+#include "./utility.h"
+#include <cstdint>
+
+/**
+ * @file bitUtil.h
+ * @brief Word-level bit manipulation helpers (popcount, count trailing zeros, masks, rotation, reversal)
+ *
+ * Thin wrappers over compiler intrinsics with portable fallbacks, shared by the
+ * bit-packed containers of the library.
+ */
+
+/**
+ * @brief Number of bits in a storage word
+ */
+constexpr size_t WORD_BITS = 64;
+
+/**
+ * @brief Counts the set bits of a 64-bit word
+ * @param x Input word
+ * @return Number of bits set to 1
+ */
+inline int popcount64(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(x);
+#else
+    int count = 0;
+    while (x) {
+        x &= x - 1;
+        ++count;
+    }
+    return count;
+#endif
+}
+
+/**
+ * @brief Counts the trailing zero bits of a non-zero 64-bit word
+ * @param x Input word (must be non-zero)
+ * @return Index of the lowest set bit
+ */
+inline int ctz64(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(x);
+#else
+    int count = 0;
+    while ((x & 1ULL) == 0) {
+        x >>= 1;
+        ++count;
+    }
+    return count;
+#endif
+}
+
+/**
+ * @brief Builds a mask with the lowest n bits set
+ * @param n Number of bits (0 to 64)
+ * @return Mask with bits [0, n) set
+ */
+inline uint64_t lowMask64(size_t n) {
+    return n >= WORD_BITS ? ~0ULL : ((1ULL << n) - 1ULL);
+}
+
+/**
+ * @brief Number of 64-bit words needed to hold n bits
+ * @param n Number of bits
+ * @return Word count
+ */
+inline size_t wordsForBits(size_t n) {
+    return (n + WORD_BITS - 1) / WORD_BITS;
+}
+
+/**
+ * @brief Reverses the bit order of a 64-bit word
+ * @param x Input word
+ * @return Word with bit i moved to bit 63 - i
+ */
+inline uint64_t reverseBits64(uint64_t x) {
+    x = ((x >> 1) & 0x5555555555555555ULL) | ((x & 0x5555555555555555ULL) << 1);
+    x = ((x >> 2) & 0x3333333333333333ULL) | ((x & 0x3333333333333333ULL) << 2);
+    x = ((x >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((x & 0x0F0F0F0F0F0F0F0FULL) << 4);
+    x = ((x >> 8) & 0x00FF00FF00FF00FFULL) | ((x & 0x00FF00FF00FF00FFULL) << 8);
+    x = ((x >> 16) & 0x0000FFFF0000FFFFULL) | ((x & 0x0000FFFF0000FFFFULL) << 16);
+    return (x >> 32) | (x << 32);
+}
+
+/**
+ * @brief Rotates the lowest width bits of a word towards the high end
+ * @param x Input word (bits at or above width must be zero)
+ * @param shift Rotation amount in [0, width)
+ * @param width Number of bits taking part in the rotation (1 to 64)
+ * @return Rotated word, bit i moved to bit (i + shift) % width
+ */
+inline uint64_t rotateBitsLeft(uint64_t x, size_t shift, size_t width) {
+    if (shift == 0) return x;
+    return ((x << shift) | (x >> (width - shift))) & lowMask64(width);
+}
+
+#endif // BITUTIL_H
@@ -332,7 +332,7 @@ public:
  * 
  */
 
-PositionVector chord(PositionVector& scale, PositionVector& degrees, int shift = 0, int rototranslation = 0, int preVoices = 0, int position = 0, bool invert = false, int axis = 0, bool negative = false, int negativePos = 10) {
+PositionVector chord(const PositionVectorView& scale, const PositionVector& degrees, int shift = 0, int rototranslation = 0, int preVoices = 0, int position = 0, bool invert = false, int axis = 0, bool negative = false, int negativePos = 10) {
     PositionVector offsetDegrees = degrees + shift;
     PositionVector result = select(scale, offsetDegrees, rototranslation, preVoices);
     result = (invert) ? result.inversion(axis, true) : result;
@@ -354,7 +354,7 @@ PositionVector chord(PositionVector& scale, PositionVector& degrees, int shift =
  * @return IntervalVector representing the generated chord
  * 
  */
-PositionVector chord(PositionVector& scale, IntervalVector& intervals, int shift = 0, int rotation = 0, int preVoices = 0, int position = 0, bool invert = false, int axis = 0, bool negative = false, int negativePos = 10){
+PositionVector chord(const PositionVectorView& scale, const IntervalVector& intervals, int shift = 0, int rotation = 0, int preVoices = 0, int position = 0, bool invert = false, int axis = 0, bool negative = false, int negativePos = 10){
     IntervalVector offsetIntervals = intervals;
     offsetIntervals.setOffset(shift);
     PositionVector result = select(scale, offsetIntervals, rotation, preVoices);
@@ -377,7 +377,7 @@ PositionVector chord(PositionVector& scale, IntervalVector& intervals, int shift
  * @return IntervalVector representing the generated chord
  * 
  */
-IntervalVector chord(IntervalVector& scale, PositionVector& degrees, int shift = 0, int rototranslation = 0, int preVoices = 0, int position = 0, bool invert = false, int axis = 0, bool mirror = false, int mirrorPos = 0) {
+IntervalVector chord(const IntervalVectorView& scale, const PositionVector& degrees, int shift = 0, int rototranslation = 0, int preVoices = 0, int position = 0, bool invert = false, int axis = 0, bool mirror = false, int mirrorPos = 0) {
     //PositionVector scalePositions = intervalsToPositions(scale);
     PositionVector offsetDegrees = degrees + shift;
     IntervalVector result = select(scale, offsetDegrees, rototranslation, preVoices);
@@ -404,7 +404,7 @@ IntervalVector chord(IntervalVector& scale, PositionVector& degrees, int shift =
  * @return IntervalVector representing the generated chord
  * 
  */
-IntervalVector chord(IntervalVector& scale, IntervalVector& intervals, int shift = 0, int rotation = 0, int preVoices = 0, int position = 0, bool invert = false, int axis = 0, bool mirror = false, int mirrorPos = 0) {
+IntervalVector chord(const IntervalVectorView& scale, const IntervalVector& intervals, int shift = 0, int rotation = 0, int preVoices = 0, int position = 0, bool invert = false, int axis = 0, bool mirror = false, int mirrorPos = 0) {
     //PositionVector scalePositions = intervalsToPositions(scale);
     IntervalVector offsetIntervals = intervals;
     int off = intervals.getOffset();
@@ -418,4 +418,25 @@ IntervalVector chord(IntervalVector& scale, IntervalVector& intervals, int shift
     result = result.rotoTranslate(position);
     return result;
 };
+
+/**
+ * @brief chord overloads for owning, non-const scales and criteria
+ * @details Forward to the overloads above, which read the scale through a view.
+ */
+PositionVector chord(PositionVector& scale, PositionVector& degrees, int shift = 0, int rototranslation = 0, int preVoices = 0, int position = 0, bool invert = false, int axis = 0, bool negative = false, int negativePos = 10) {
+    return chord(PositionVectorView(scale), degrees, shift, rototranslation, preVoices, position, invert, axis, negative, negativePos);
+}
+
+PositionVector chord(PositionVector& scale, IntervalVector& intervals, int shift = 0, int rotation = 0, int preVoices = 0, int position = 0, bool invert = false, int axis = 0, bool negative = false, int negativePos = 10) {
+    return chord(PositionVectorView(scale), intervals, shift, rotation, preVoices, position, invert, axis, negative, negativePos);
+}
+
+IntervalVector chord(IntervalVector& scale, PositionVector& degrees, int shift = 0, int rototranslation = 0, int preVoices = 0, int position = 0, bool invert = false, int axis = 0, bool mirror = false, int mirrorPos = 0) {
+    return chord(IntervalVectorView(scale), degrees, shift, rototranslation, preVoices, position, invert, axis, mirror, mirrorPos);
+}
+
+IntervalVector chord(IntervalVector& scale, IntervalVector& intervals, int shift = 0, int rotation = 0, int preVoices = 0, int position = 0, bool invert = false, int axis = 0, bool mirror = false, int mirrorPos = 0) {
+    return chord(IntervalVectorView(scale), intervals, shift, rotation, preVoices, position, invert, axis, mirror, mirrorPos);
+}
+
 #endif // CHORD_H
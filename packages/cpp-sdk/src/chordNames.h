@@ -8,7 +8,8 @@
  * Provides functionality to analyze a set of MIDI notes and construct a chord name based on standard music theory conventions. 
  */
 
-#include "../src/utility.h"
+#include "../src/mathUtil.h"
+#include "../src/bitUtil.h"
 
 struct ChordAnalysis {
     int root;
@@ -77,137 +78,165 @@ string intervalToString(int interval) {
     return to_string(interval);
 }
 
-ChordAnalysis analyzeChord(const vector<int>& midiNotes, int rootIndex) {
-    ChordAnalysis analysis;
-    analysis.root = midiNotes[rootIndex];
-    
-    multiset<int> intervals;
-    set<int> usedIntervals;
-    
+/**
+ * @brief Interval mask of a chord above one of its notes
+ * @param midiNotes Chord notes
+ * @param rootIndex Index of the root note
+ * @return Bit i set if some other note lies i semitones above the root, with notes
+ *         below the root raised by octaves and notes two octaves or more above it
+ *         lowered by octaves, so every interval is in [0, 24)
+ */
+uint32_t chordIntervalMask(const vector<int>& midiNotes, size_t rootIndex) {
+    uint32_t intervals = 0;
     for (size_t i = 0; i < midiNotes.size(); i++) {
         if (i != rootIndex) {
             int interval = midiNotes[i] - midiNotes[rootIndex];
-            while (interval < 0) interval += 12;
-            while (interval >= 24) interval -= 12;
-            intervals.insert(interval);
+            if (interval < 0) {
+                interval = euclideanDivision(interval, 12).remainder;
+            } else if (interval >= 24) {
+                interval = 12 + euclideanDivision(interval, 12).remainder;
+            }
+            intervals |= 1u << interval;
         }
     }
+    return intervals;
+}
+
+/**
+ * @brief Analyzes a chord given as the interval mask above its root
+ * @param intervals Mask as returned by chordIntervalMask
+ * @param root Root note, kept in the result
+ * @return Chord components, with unclassified intervals in addedNotes in ascending order
+ */
+ChordAnalysis analyzeIntervals(uint32_t intervals, int root) {
+    ChordAnalysis analysis;
+    analysis.root = root;
+
+    uint32_t used = 0;
+    auto available = [&](int interval) { return ((intervals & ~used) >> interval) & 1u; };
     
-    if (intervals.count(3) && !usedIntervals.count(3)) {
+    if (available(3)) {
         analysis.hasThird = true;
         analysis.hasMinorThird = true;
-        usedIntervals.insert(3);
-    } else if (intervals.count(4) && !usedIntervals.count(4)) {
+        used |= 1u << 3;
+    } else if (available(4)) {
         analysis.hasThird = true;
         analysis.hasMajorThird = true;
-        usedIntervals.insert(4);
+        used |= 1u << 4;
     }
     
 
-    if (intervals.count(7) && !usedIntervals.count(7)) {
+    if (available(7)) {
         analysis.hasFifth = true;
         analysis.hasPerfectFifth = true;
-        usedIntervals.insert(7);
-    } else if (intervals.count(6) && !usedIntervals.count(6) && analysis.hasThird) {
+        used |= 1u << 7;
+    } else if (available(6) && analysis.hasThird) {
         analysis.hasFifth = true;
         analysis.hasDiminishedFifth = true;
-        usedIntervals.insert(6);
-    } else if (intervals.count(8) && !usedIntervals.count(8) && analysis.hasMajorThird) {
+        used |= 1u << 6;
+    } else if (available(8) && analysis.hasMajorThird) {
         analysis.hasFifth = true;
         analysis.hasAugmentedFifth = true;
-        usedIntervals.insert(8);
+        used |= 1u << 8;
     }
     
     analysis.hasCompleteTriad = analysis.hasThird && analysis.hasFifth;
     
 
-    if (intervals.count(11) && !usedIntervals.count(11)) {
+    if (available(11)) {
         analysis.hasSeventh = true;
         analysis.hasMajorSeventh = true;
-        usedIntervals.insert(11);
-    } else if (intervals.count(10) && !usedIntervals.count(10)) {
+        used |= 1u << 11;
+    } else if (available(10)) {
         analysis.hasSeventh = true;
         analysis.hasMinorSeventh = true;
-        usedIntervals.insert(10);
-    } else if (intervals.count(9) && !usedIntervals.count(9) && analysis.hasMinorThird && analysis.hasDiminishedFifth) {
+        used |= 1u << 10;
+    } else if (available(9) && analysis.hasMinorThird && analysis.hasDiminishedFifth) {
         analysis.hasSeventh = true;
         analysis.hasDiminishedSeventh = true;
-        usedIntervals.insert(9);
+        used |= 1u << 9;
     }
     
-    if (intervals.count(13) && !usedIntervals.count(13)) {
+    if (available(13)) {
         analysis.hasNinth = true;
         analysis.hasFlatNinth = true;
-        usedIntervals.insert(13);
-    } else if (intervals.count(14) && !usedIntervals.count(14)) {
+        used |= 1u << 13;
+    } else if (available(14)) {
         analysis.hasNinth = true;
         analysis.hasNaturalNinth = true;
-        usedIntervals.insert(14);
+        used |= 1u << 14;
     }
     
-    if (intervals.count(17) && !usedIntervals.count(17)) {
+    if (available(17)) {
         analysis.hasEleventh = true;
         analysis.hasNaturalEleventh = true;
-        usedIntervals.insert(17);
-    } else if (intervals.count(18) && !usedIntervals.count(18)) {
+        used |= 1u << 17;
+    } else if (available(18)) {
         analysis.hasEleventh = true;
         analysis.hasSharpEleventh = true;
-        usedIntervals.insert(18);
+        used |= 1u << 18;
     }
     
-    if (intervals.count(20) && !usedIntervals.count(20)) {
+    if (available(20)) {
         analysis.hasThirteenth = true;
         analysis.hasFlatThirteenth = true;
-        usedIntervals.insert(20);
-    } else if (intervals.count(21) && !usedIntervals.count(21)) {
+        used |= 1u << 20;
+    } else if (available(21)) {
         analysis.hasThirteenth = true;
         analysis.hasNaturalThirteenth = true;
-        usedIntervals.insert(21);
+        used |= 1u << 21;
     }
     
-    if (intervals.count(1) && !usedIntervals.count(1)) {
+    if (available(1)) {
         analysis.hasSecond = true;
         analysis.hasFlatSecond = true;
-        usedIntervals.insert(1);
-    } else if (intervals.count(2) && !usedIntervals.count(2)) {
+        used |= 1u << 1;
+    } else if (available(2)) {
         analysis.hasSecond = true;
         analysis.hasNaturalSecond = true;
-        usedIntervals.insert(2);
+        used |= 1u << 2;
     }
     
-    if (intervals.count(5) && !usedIntervals.count(5)) {
+    if (available(5)) {
         analysis.hasFourth = true;
         analysis.hasNaturalFourth = true;
-        usedIntervals.insert(5);
-    } else if (intervals.count(6) && !usedIntervals.count(6)) {
+        used |= 1u << 5;
+    } else if (available(6)) {
         analysis.hasFourth = true;
         analysis.hasSharpFourth = true;
-        usedIntervals.insert(6);
+        used |= 1u << 6;
     }
     
-    if (intervals.count(8) && !usedIntervals.count(8)) {
+    if (available(8)) {
         analysis.hasSixth = true;
         analysis.hasFlatSixth = true;
-        usedIntervals.insert(8);
+        used |= 1u << 8;
     }
-    if (intervals.count(9) && !usedIntervals.count(9)) {
+    if (available(9)) {
         analysis.hasSixth = true;
         analysis.hasNaturalSixth = true;
-        usedIntervals.insert(9);
+        used |= 1u << 9;
     }
     
-    for (int interval : intervals) {
-        if (usedIntervals.count(interval) == 0) {
-            analysis.addedNotes.push_back({interval, intervalToString(interval)});
-            usedIntervals.insert(interval);
-        }
+    for (uint32_t rest = intervals & ~used; rest != 0; rest &= rest - 1) {
+        int interval = ctz64(rest);
+        analysis.addedNotes.push_back({interval, intervalToString(interval)});
     }
     
     return analysis;
 }
 
-string buildChordName(const ChordAnalysis& analysis) {
-    string name = noteToString(analysis.root);
+ChordAnalysis analyzeChord(const vector<int>& midiNotes, int rootIndex) {
+    return analyzeIntervals(chordIntervalMask(midiNotes, static_cast<size_t>(rootIndex)), midiNotes[rootIndex]);
+}
+
+/**
+ * @brief Chord quality, extensions and added notes, without the root name
+ * @param analysis Chord components (the root is not used)
+ * @return Suffix such that the chord name is the root name followed by it
+ */
+string buildChordSuffix(const ChordAnalysis& analysis) {
+    string name;
     bool omitFifth = false;
     bool omitThird = false;
     
@@ -448,4 +477,167 @@ string buildChordName(const ChordAnalysis& analysis) {
     return name;
 }
 
+string buildChordName(const ChordAnalysis& analysis) {
+    return noteToString(analysis.root) + buildChordSuffix(analysis);
+}
+
+// ==================== ROOT DETECTION ====================
+
+/**
+ * @brief Root-independent plausibility of an analysis as a chord above its root
+ * @details Third 3, fifth 2, complete triad 2 more, seventh 1. Every added second, fourth
+ *          or flat sixth costs 1, and so does a natural sixth next to a seventh (a sixth
+ *          alone makes a 6 chord). Every unclassified interval costs 2.
+ */
+int chordRootScore(const ChordAnalysis& analysis) {
+    int score = 3 * analysis.hasThird + 2 * analysis.hasFifth + 2 * analysis.hasCompleteTriad +
+                analysis.hasSeventh;
+    score -= analysis.hasFlatSecond + analysis.hasNaturalSecond + analysis.hasNaturalFourth +
+             analysis.hasSharpFourth + analysis.hasFlatSixth +
+             (analysis.hasNaturalSixth && analysis.hasSeventh);
+    score -= 2 * static_cast<int>(analysis.addedNotes.size());
+    return score;
+}
+
+/**
+ * @brief Best naming of a chord over all candidate roots
+ */
+struct NamedChord {
+    size_t rootIndex;       ///< Index of the chosen root in the input notes
+    int score;              ///< chordRootScore of the analysis, plus 1 if the root is the bass
+    ChordAnalysis analysis; ///< Analysis above the chosen root
+    string name;            ///< Chord name
+};
+
+/**
+ * @class ChordNameTable
+ * @brief Chord analyses, suffixes and scores keyed by interval mask
+ * @details Masks of chords within an octave above the root (every pitch-class set seen
+ *          from every root) are analyzed once, on first use, into a shared read-only
+ *          table. Masks with compound intervals (ninths and above) are analyzed on demand
+ *          and cached per table.
+ * @note A table is not thread-safe. The free functions below use one table per thread.
+ */
+class ChordNameTable {
+public:
+    /**
+     * @brief Analysis of one interval mask
+     */
+    struct Entry {
+        ChordAnalysis analysis; ///< Analysis with root 0
+        string suffix;          ///< buildChordSuffix of the analysis
+        int score;              ///< chordRootScore of the analysis
+    };
+
+private:
+    unordered_map<uint32_t, Entry> compound_;
+
+    static Entry makeEntry(uint32_t intervals) {
+        ChordAnalysis analysis = analyzeIntervals(intervals, 0);
+        string suffix = buildChordSuffix(analysis);
+        int score = chordRootScore(analysis);
+        return {move(analysis), move(suffix), score};
+    }
+
+    static const vector<Entry>& simple() {
+        static const vector<Entry> table = [] {
+            vector<Entry> entries;
+            entries.reserve(4096);
+            for (uint32_t intervals = 0; intervals < 4096; ++intervals) {
+                entries.push_back(makeEntry(intervals));
+            }
+            return entries;
+        }();
+        return table;
+    }
+
+public:
+    /**
+     * @brief Analysis of an interval mask
+     * @param intervals Mask as returned by chordIntervalMask
+     * @return Reference valid for the lifetime of the table
+     */
+    const Entry& lookup(uint32_t intervals) {
+        if (intervals < 4096) {
+            return simple()[intervals];
+        }
+        auto it = compound_.find(intervals);
+        if (it == compound_.end()) {
+            it = compound_.emplace(intervals, makeEntry(intervals)).first;
+        }
+        return it->second;
+    }
+
+    /**
+     * @brief Analyzes a chord above a given root
+     * @return Same result as analyzeChord
+     */
+    ChordAnalysis analyze(const vector<int>& midiNotes, size_t rootIndex) {
+        ChordAnalysis analysis = lookup(chordIntervalMask(midiNotes, rootIndex)).analysis;
+        analysis.root = midiNotes[rootIndex];
+        return analysis;
+    }
+
+    /**
+     * @brief Names a chord above a given root
+     * @return Same result as buildChordName(analyzeChord(midiNotes, rootIndex))
+     */
+    string name(const vector<int>& midiNotes, size_t rootIndex) {
+        return noteToString(midiNotes[rootIndex]) + lookup(chordIntervalMask(midiNotes, rootIndex)).suffix;
+    }
+
+    /**
+     * @brief Names a chord choosing its root automatically
+     * @details Every note is tried as the root and scored with chordRootScore, plus 1 for
+     *          the lowest note. Ties go to the earlier note in the input.
+     * @param midiNotes Chord notes, in any order
+     * @return Best root, its analysis and the chord name
+     * @throw invalid_argument If midiNotes is empty
+     */
+    NamedChord nameChord(const vector<int>& midiNotes) {
+        if (midiNotes.empty()) {
+            throw invalid_argument("Chord must contain at least one note");
+        }
+        int bass = *min_element(midiNotes.begin(), midiNotes.end());
+        const Entry* best = nullptr;
+        size_t bestIndex = 0;
+        int bestScore = 0;
+        for (size_t i = 0; i < midiNotes.size(); ++i) {
+            const Entry& entry = lookup(chordIntervalMask(midiNotes, i));
+            int score = entry.score + (midiNotes[i] == bass);
+            if (best == nullptr || score > bestScore) {
+                best = &entry;
+                bestIndex = i;
+                bestScore = score;
+            }
+        }
+        ChordAnalysis analysis = best->analysis;
+        analysis.root = midiNotes[bestIndex];
+        return {bestIndex, bestScore, move(analysis), noteToString(midiNotes[bestIndex]) + best->suffix};
+    }
+
+    /**
+     * @brief Number of cached compound masks (the shared table is not counted)
+     */
+    size_t cachedMasks() const { return compound_.size(); }
+
+    void clearCache() { compound_.clear(); }
+};
+
+/**
+ * @brief Table of the calling thread, used by nameChord
+ */
+inline ChordNameTable& chordNameTable() {
+    thread_local ChordNameTable table;
+    return table;
+}
+
+/**
+ * @brief Names a chord choosing its root automatically
+ * @see ChordNameTable::nameChord
+ */
+inline NamedChord nameChord(const vector<int>& midiNotes) {
+    return chordNameTable().nameChord(midiNotes);
+}
+
 #endif // CHORDNAMES_H
@@ -2,6 +2,8 @@
 #define DISTANCES_H
 
 #include "./vectors.h"
+#include "./batchDistance.h"
+#include "./parallel.h"
 
 /**
  * @file distances.h
@@ -46,7 +48,7 @@ vector<double> computeCDF(vector<double>& pdf) {
  * @param v2 Second input vector
  * @return Euclidean distance as a double
  */
-double euclideanDistance(vector<int> v1, vector<int> v2) {
+double euclideanDistance(const VectorData& v1, const VectorData& v2) {
     int length = min(v1.size(), v2.size());
     
     double out = 0.0;
@@ -58,29 +60,170 @@ double euclideanDistance(vector<int> v1, vector<int> v2) {
     return sqrt(out);
 }
 /**
- * @brief Calculates the Levenshtein edit distance between two vectors of integers
+ * @brief Calculates the Levenshtein edit distance with two DP rows
  * @param v1 First input vector
  * @param v2 Second input vector
  * @return Edit distance as an integer
+ * @details Keeps one row over the shorter vector, O(min(n, m)) memory. Rows of up to 32
+ *          elements stay on the stack.
  */
-int editDistance(vector<int>& v1, vector<int>& v2) {
-    int n = v1.size();
-    int m = v2.size();
-    vector<vector<int>> dp(n + 1, vector<int>(m + 1, 0));
+int editDistanceLinear(const VectorData& v1, const VectorData& v2) {
+    const VectorData& longer = v1.size() >= v2.size() ? v1 : v2;
+    const VectorData& shorter = v1.size() >= v2.size() ? v2 : v1;
+    int n = longer.size();
+    int m = shorter.size();
 
-    for (int i = 0; i <= n; ++i) dp[i][0] = i;
-    for (int j = 0; j <= m; ++j) dp[0][j] = j;
+    SmallVector<int, 66> rows(2 * static_cast<size_t>(m + 1));
+    int* prev = rows.data();
+    int* cur = prev + (m + 1);
+    for (int j = 0; j <= m; ++j) prev[j] = j;
 
     for (int i = 1; i <= n; ++i) {
+        cur[0] = i;
         for (int j = 1; j <= m; ++j) {
-            if (v1[i - 1] == v2[j - 1]) {
-                dp[i][j] = dp[i - 1][j - 1];
+            if (longer[i - 1] == shorter[j - 1]) {
+                cur[j] = prev[j - 1];
             } else {
-                dp[i][j] = 1 + min({dp[i - 1][j], dp[i][j - 1], dp[i - 1][j - 1]});
+                cur[j] = 1 + min({prev[j], cur[j - 1], prev[j - 1]});
             }
         }
+        swap(prev, cur);
+    }
+    return prev[m];
+}
+
+/**
+ * @brief Calculates the Levenshtein edit distance with Myers' bit-parallel algorithm
+ * @param v1 First input vector
+ * @param v2 Second input vector
+ * @return Edit distance as an integer
+ * @throw invalid_argument If both vectors are longer than 64 elements
+ * @details Hyyrö's formulation: the vertical deltas of a DP column over the shorter vector
+ *          (the pattern) are two 64-bit words, updated with a few logical operations and one
+ *          addition per element of the longer vector, O(n) time. The per-value match masks
+ *          are kept in a small open-addressing table on the stack.
+ */
+int editDistanceBitParallel(const VectorData& v1, const VectorData& v2) {
+    const VectorData& text = v1.size() >= v2.size() ? v1 : v2;
+    const VectorData& pattern = v1.size() >= v2.size() ? v2 : v1;
+    size_t m = pattern.size();
+    if (m > WORD_BITS) {
+        throw invalid_argument("Bit-parallel edit distance needs a vector of at most 64 elements");
+    }
+    if (m == 0) {
+        return text.size();
+    }
+
+    // Match mask of each distinct pattern value; 128 slots keep the load at most 1/2
+    constexpr size_t SLOTS = 128;
+    int keys[SLOTS];
+    uint64_t masks[SLOTS];
+    bool used[SLOTS] = {};
+    auto slotOf = [&](int value) {
+        size_t slot = (static_cast<uint32_t>(value) * 2654435761u) >> 25;
+        while (used[slot] && keys[slot] != value) {
+            slot = (slot + 1) & (SLOTS - 1);
+        }
+        return slot;
+    };
+    for (size_t i = 0; i < m; ++i) {
+        size_t slot = slotOf(pattern[i]);
+        if (!used[slot]) {
+            used[slot] = true;
+            keys[slot] = pattern[i];
+            masks[slot] = 0;
+        }
+        masks[slot] |= 1ULL << i;
+    }
+
+    uint64_t pv = ~0ULL;
+    uint64_t mv = 0;
+    uint64_t last = 1ULL << (m - 1);
+    int score = static_cast<int>(m);
+    for (int value : text) {
+        size_t slot = slotOf(value);
+        uint64_t eq = used[slot] ? masks[slot] : 0;
+        uint64_t xv = eq | mv;
+        uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+        uint64_t ph = mv | ~(xh | pv);
+        uint64_t mh = pv & xh;
+        if (ph & last) {
+            ++score;
+        } else if (mh & last) {
+            --score;
+        }
+        // The first row grows by one per element, so a +1 delta enters at the bottom
+        ph = (ph << 1) | 1;
+        mh <<= 1;
+        pv = mh | ~(xv | ph);
+        mv = ph & xv;
     }
-    return dp[n][m];
+    return score;
+}
+
+/**
+ * @brief Calculates the Levenshtein edit distance up to a threshold
+ * @param v1 First input vector
+ * @param v2 Second input vector
+ * @param maxDistance Largest distance of interest (non-negative)
+ * @return Edit distance if it is at most maxDistance, otherwise maxDistance + 1
+ * @throw invalid_argument If maxDistance is negative
+ * @details Only the diagonal band of width 2 * maxDistance + 1 is computed, and the
+ *          computation stops as soon as a whole row exceeds maxDistance, O(n * maxDistance)
+ *          time at worst and often much less for dissimilar sequences.
+ */
+int editDistanceBounded(const VectorData& v1, const VectorData& v2, int maxDistance) {
+    if (maxDistance < 0) {
+        throw invalid_argument("maxDistance must be non-negative");
+    }
+    int n = v1.size();
+    int m = v2.size();
+    int limit = maxDistance + 1;
+    if (abs(n - m) > maxDistance) {
+        return limit;
+    }
+
+    SmallVector<int, 66> rows(2 * static_cast<size_t>(m + 1));
+    int* prev = rows.data();
+    int* cur = prev + (m + 1);
+    for (int j = 0; j <= m; ++j) prev[j] = min(j, limit);
+
+    for (int i = 1; i <= n; ++i) {
+        int lo = max(1, i - maxDistance);
+        int hi = min(m, i + maxDistance);
+        // Cells just outside the band act as "too far"
+        cur[0] = min(i, limit);
+        cur[lo - 1] = lo == 1 ? cur[0] : limit;
+        int rowMin = cur[lo - 1];
+        for (int j = lo; j <= hi; ++j) {
+            int best = prev[j - 1] + (v1[i - 1] != v2[j - 1] ? 1 : 0);
+            best = min(best, prev[j] + 1);
+            best = min(best, cur[j - 1] + 1);
+            cur[j] = min(best, limit);
+            rowMin = min(rowMin, cur[j]);
+        }
+        if (hi < m) cur[hi + 1] = limit;
+        if (rowMin >= limit) {
+            return limit;
+        }
+        swap(prev, cur);
+    }
+    return prev[m];
+}
+
+/**
+ * @brief Calculates the Levenshtein edit distance between two vectors of integers
+ * @param v1 First input vector
+ * @param v2 Second input vector
+ * @return Edit distance as an integer
+ * @details Uses editDistanceBitParallel when the shorter vector has at most 64 elements,
+ *          editDistanceLinear otherwise.
+ */
+int editDistance(const VectorData& v1, const VectorData& v2) {
+    if (min(v1.size(), v2.size()) <= WORD_BITS) {
+        return editDistanceBitParallel(v1, v2);
+    }
+    return editDistanceLinear(v1, v2);
 }
 
 /**
@@ -91,7 +234,7 @@ int editDistance(vector<int>& v1, vector<int>& v2) {
  * @details The Hamming distance is the number of positions at which the corresponding elements are different.
  *          If the vectors are of different lengths, the comparison is done up to the length of the shorter vector.
  */
-int hammingDistance(vector<int>& v1, vector<int>& v2) {
+int hammingDistance(const VectorData& v1, const VectorData& v2) {
     int length = min(v1.size(), v2.size());
     int distance = 0;
     for (size_t i = 0; i < length; ++i) {
@@ -109,7 +252,7 @@ int hammingDistance(vector<int>& v1, vector<int>& v2) {
  * @details The Manhattan distance is the sum of the absolute differences of their corresponding elements.
  *          If the vectors are of different lengths, the comparison is done up to the length of the shorter vector.
  */
-int manhattanDistance(vector<int>& v1, vector<int>& v2){
+int manhattanDistance(const VectorData& v1, const VectorData& v2){
     int length = min(v1.size(), v2.size());
     int sum = 0;
     for (size_t i = 0; i < length; ++i){
@@ -125,7 +268,7 @@ int manhattanDistance(vector<int>& v1, vector<int>& v2){
  * @details The difference is calculated as the sum of (v1[i] - v2[i]) for each corresponding element.
  *          If the vectors are of different lengths, the comparison is done up to the length of the shorter vector.
  */
-int difference(vector<int>& v1, vector<int>& v2) {
+int difference(const VectorData& v1, const VectorData& v2) {
     int length = min(v1.size(), v2.size());
     int diff = 0;
     for (size_t i = 0; i < length; ++i) {
@@ -151,50 +294,61 @@ vector<int> generalizedNeoRiemann(const vector<int>& input, int position, int sh
 }
 
 /**
- * @brief Computes the sequence of transformation steps to convert one vector into another
+ * @brief One transformation step: (type, (position, value)), type 0 = shift, 1 = add, 2 = remove
+ */
+using TransformationStep = pair<int, pair<int, int>>;
+
+/**
+ * @brief Writes the transformation steps from one vector to another into a buffer
  * @param start Starting vector
  * @param end Target vector
- * @return Vector of transformation steps, each represented as a pair:
- *        - First element: type of operation (0 = shift, 1 = add, 2 = remove)
- *       - Second element: pair of (position, value)
- * @details The function identifies the minimal set of operations needed to transform the start vector into the end vector.
- *          It handles element shifts, additions, and removals.
+ * @param steps Buffer receiving the steps; it is cleared first, so a reused buffer does not
+ *        allocate once its capacity is large enough
+ * @details Same steps as transformationSteps(start, end): a shift for every position of the
+ *          common prefix where the values differ, in position order, then the additions or
+ *          removals past the shorter length. One pass, no recursion and no copies.
  */
-vector<pair<int, pair<int, int>>> transformationSteps(const vector<int>& start, const vector<int>& end) {
-    vector<pair<int, pair<int, int>>> steps;
+template<typename Container>
+void transformationSteps(const Container& start, const Container& end, vector<TransformationStep>& steps) {
+    steps.clear();
     int startLength = start.size();
     int endLength = end.size();
     int minLength = min(startLength, endLength);
-    int addedPosition = startLength;
-    
+
     for (int i = 0; i < minLength; ++i) {
         int diff = end[i] - start[i];
         if (diff != 0) {
             steps.push_back({0, {i, diff}});
-            vector<int> transformed = generalizedNeoRiemann(start, i, diff);
-            vector<pair<int, pair<int, int>>> substeps = transformationSteps(transformed, end);
-            steps.insert(steps.end(), substeps.begin(), substeps.end());
-            return steps;
         }
     }
-    
-    if (endLength > startLength) {
-        for (int i = minLength; i < endLength; ++i) {
-            steps.push_back({1, {addedPosition, end[i]}});
-            addedPosition++;
-        }
+
+    // Added elements are appended after the original elements
+    for (int i = minLength; i < endLength; ++i) {
+        steps.push_back({1, {i, end[i]}});
     }
-    
-    if (endLength < startLength) {
-        for (int i = minLength; i < startLength; ++i) {
-            steps.push_back({2, {i, start[i]}});
-        }
+
+    for (int i = minLength; i < startLength; ++i) {
+        steps.push_back({2, {i, start[i]}});
     }
-    
+}
+
+/**
+ * @brief Computes the sequence of transformation steps to convert one vector into another
+ * @param start Starting vector
+ * @param end Target vector
+ * @return Vector of transformation steps, each represented as a pair:
+ *        - First element: type of operation (0 = shift, 1 = add, 2 = remove)
+ *       - Second element: pair of (position, value)
+ * @details The function identifies the minimal set of operations needed to transform the start vector into the end vector.
+ *          It handles element shifts, additions, and removals.
+ */
+vector<TransformationStep> transformationSteps(const vector<int>& start, const vector<int>& end) {
+    vector<TransformationStep> steps;
+    transformationSteps(start, end, steps);
     return steps;
 }
 // Print transformation steps
-void printSteps(const vector<pair<int, pair<int, int>>>& steps) {
+void printSteps(const vector<TransformationStep>& steps) {
     for (const auto& step : steps) {
         int type = step.first;
         int position = step.second.first;
@@ -211,6 +365,29 @@ void printSteps(const vector<pair<int, pair<int, int>>>& steps) {
     }
 }
 
+/**
+ * @brief Sum of the weights of the transformation steps from start to end
+ * @details Shared by the VectorData and view overloads of weightedTransformationDistance.
+ */
+template<typename Seq>
+int weightedTransformationSum(const Seq& start, const Seq& end) {
+    // Sum of the step weights of transformationSteps, without materializing the steps
+    const int* a = start.data();
+    const int* b = end.data();
+    size_t minLength = min(start.size(), end.size());
+    int distance = 0;
+    for (size_t i = 0; i < minLength; ++i) {
+        distance += abs(b[i] - a[i]);
+    }
+    for (size_t i = minLength; i < end.size(); ++i) {
+        distance += abs(b[i]);
+    }
+    for (size_t i = minLength; i < start.size(); ++i) {
+        distance += abs(a[i]);
+    }
+    return distance;
+}
+
 /**
  * @brief Calculates the weighted transformation distance between two vectors of integers
  * @param start Starting vector
@@ -218,14 +395,8 @@ void printSteps(const vector<pair<int, pair<int, int>>>& steps) {
  * @return Weighted transformation distance as an integer
  * @details The distance is calculated as the sum of the absolute values of the shifts applied during the transformation.
  */
-int weightedTransformationDistance(vector<int>& start, vector<int>& end) {
-    vector<pair<int, pair<int, int>>> steps = transformationSteps(start, end);
-    int distance = 0;
-    for (const auto& step : steps) {
-        int weight = abs(step.second.second);
-        distance += weight;
-    }
-    return distance;
+int weightedTransformationDistance(const VectorData& start, const VectorData& end) {
+    return weightedTransformationSum(start, end);
 }
 
 // Overloaded functions for PositionVector and IntervalVector
@@ -233,50 +404,257 @@ int weightedTransformationDistance(vector<int>& start, vector<int>& end) {
 /**
  * @brief Overloaded distance functions for PositionVector and IntervalVector
  * @details These functions extract the underlying data vectors and call the corresponding distance functions.
+ *          Arguments are taken by reference, so no vector is copied.
  */
 
-double euclideanDistance(PositionVector a, PositionVector b){
+double euclideanDistance(const PositionVector& a, const PositionVector& b){
     return euclideanDistance(a.data, b.data);
 }
-int manhattanDistance(PositionVector a, PositionVector b){
+int manhattanDistance(const PositionVector& a, const PositionVector& b){
     return manhattanDistance(a.data, b.data);
 }
 
-int editDistance(PositionVector a, PositionVector b){
+int editDistance(const PositionVector& a, const PositionVector& b){
     return editDistance(a.data, b.data);
 }
 
-int weightedTransformationDistance(PositionVector a, PositionVector b){
+int weightedTransformationDistance(const PositionVector& a, const PositionVector& b){
     return weightedTransformationDistance(a.data, b.data);
 }
 
-int difference(PositionVector a, PositionVector b){
+int difference(const PositionVector& a, const PositionVector& b){
     return difference(a.data, b.data);
 }
 
-int hammingDistance(PositionVector a, PositionVector b){
+int hammingDistance(const PositionVector& a, const PositionVector& b){
     return hammingDistance(a.data, b.data);
 }
 
-int difference(IntervalVector a, IntervalVector b){
+int difference(const IntervalVector& a, const IntervalVector& b){
     return difference(a.data, b.data);
 }
-int hammingDistance(IntervalVector a, IntervalVector b){
+int hammingDistance(const IntervalVector& a, const IntervalVector& b){
     return hammingDistance(a.data, b.data);
 }
-int manhattanDistance(IntervalVector a, IntervalVector b){
+int manhattanDistance(const IntervalVector& a, const IntervalVector& b){
     return manhattanDistance(a.data, b.data);
 }
-double euclideanDistance(IntervalVector a, IntervalVector b){
+double euclideanDistance(const IntervalVector& a, const IntervalVector& b){
     return euclideanDistance(a.data, b.data);
 }
-int editDistance(IntervalVector a, IntervalVector b){
+int editDistance(const IntervalVector& a, const IntervalVector& b){
     return editDistance(a.data, b.data);
 }
-int weightedTransformationDistance(IntervalVector a, IntervalVector b){
+int weightedTransformationDistance(const IntervalVector& a, const IntervalVector& b){
     return weightedTransformationDistance(a.data, b.data);
 }
 
+/**
+ * @brief Distance functions for PositionVectorView and IntervalVectorView
+ * @details The views are read in place. Manhattan, Euclidean, Hamming and difference run
+ *          the batch kernels of batchDistance.h on a single pair, up to the shorter length.
+ */
+
+int manhattanDistance(const PositionVectorView& a, const PositionVectorView& b) {
+    int out;
+    batchManhattanDistance(a.data(), b.data(), min(a.size(), b.size()), 1, &out);
+    return out;
+}
+double euclideanDistance(const PositionVectorView& a, const PositionVectorView& b) {
+    double out;
+    batchEuclideanDistance(a.data(), b.data(), min(a.size(), b.size()), 1, &out);
+    return out;
+}
+int hammingDistance(const PositionVectorView& a, const PositionVectorView& b) {
+    int out;
+    batchHammingDistance(a.data(), b.data(), min(a.size(), b.size()), 1, &out);
+    return out;
+}
+int difference(const PositionVectorView& a, const PositionVectorView& b) {
+    int out;
+    batchDifference(a.data(), b.data(), min(a.size(), b.size()), 1, &out);
+    return out;
+}
+int weightedTransformationDistance(const PositionVectorView& a, const PositionVectorView& b) {
+    return weightedTransformationSum(a, b);
+}
+
+int manhattanDistance(const IntervalVectorView& a, const IntervalVectorView& b) {
+    int out;
+    batchManhattanDistance(a.data(), b.data(), min(a.size(), b.size()), 1, &out);
+    return out;
+}
+double euclideanDistance(const IntervalVectorView& a, const IntervalVectorView& b) {
+    double out;
+    batchEuclideanDistance(a.data(), b.data(), min(a.size(), b.size()), 1, &out);
+    return out;
+}
+int hammingDistance(const IntervalVectorView& a, const IntervalVectorView& b) {
+    int out;
+    batchHammingDistance(a.data(), b.data(), min(a.size(), b.size()), 1, &out);
+    return out;
+}
+int difference(const IntervalVectorView& a, const IntervalVectorView& b) {
+    int out;
+    batchDifference(a.data(), b.data(), min(a.size(), b.size()), 1, &out);
+    return out;
+}
+int weightedTransformationDistance(const IntervalVectorView& a, const IntervalVectorView& b) {
+    return weightedTransformationSum(a, b);
+}
+
+// ==================== DISTANCE POLICIES ====================
+
+/**
+ * @brief Integer data a distance policy works on
+ * @details Identity for plain data, the data member for PositionVector and IntervalVector.
+ */
+template<typename Seq>
+const Seq& distanceData(const Seq& values) { return values; }
+inline const VectorData& distanceData(const PositionVector& v) { return v.data; }
+inline const VectorData& distanceData(const IntervalVector& v) { return v.data; }
+
+/**
+ * @brief Distance policies: function objects over the integer data of two vectors
+ * @details A policy accepts PositionVector, IntervalVector or VectorData arguments by
+ *          reference and is a distinct type, so algorithms templated on the distance
+ *          (calculateDistances and the selection functions in matrixDistance.h) call it
+ *          directly and the compiler can inline and vectorize the loop. Any other callable
+ *          works too: one taking the vectors, or one taking their data (VectorData), with
+ *          an int or double result. The Manhattan, Euclidean, Hamming and difference
+ *          policies also have a batch kernel (see BatchDistanceKernel).
+ */
+struct ManhattanDistancePolicy {
+    template<typename A, typename B>
+    int operator()(const A& a, const B& b) const { return manhattanDistance(distanceData(a), distanceData(b)); }
+};
+
+struct EuclideanDistancePolicy {
+    template<typename A, typename B>
+    double operator()(const A& a, const B& b) const { return euclideanDistance(distanceData(a), distanceData(b)); }
+};
+
+struct EditDistancePolicy {
+    template<typename A, typename B>
+    int operator()(const A& a, const B& b) const { return editDistance(distanceData(a), distanceData(b)); }
+};
+
+struct HammingDistancePolicy {
+    template<typename A, typename B>
+    int operator()(const A& a, const B& b) const { return hammingDistance(distanceData(a), distanceData(b)); }
+};
+
+struct DifferencePolicy {
+    template<typename A, typename B>
+    int operator()(const A& a, const B& b) const { return difference(distanceData(a), distanceData(b)); }
+};
+
+struct WeightedTransformationDistancePolicy {
+    template<typename A, typename B>
+    int operator()(const A& a, const B& b) const {
+        return weightedTransformationDistance(distanceData(a), distanceData(b));
+    }
+};
+
+/**
+ * @brief Applies a distance callable to two vectors
+ * @param distFunc Function pointer, policy or lambda over the vectors or over their data
+ * @return Distance as a double
+ * @details Callables that accept the vectors themselves get them; the others get the data.
+ *          The vectors are tried first because a callable over PositionVector values would
+ *          otherwise accept VectorData through the implicit PositionVector constructor.
+ */
+template<typename Dist, typename T>
+double evaluateDistance(const Dist& distFunc, const T& a, const T& b) {
+    if constexpr (is_invocable_v<const Dist&, const T&, const T&>) {
+        return static_cast<double>(distFunc(a, b));
+    } else {
+        return static_cast<double>(distFunc(distanceData(a), distanceData(b)));
+    }
+}
+
+// ==================== BATCH KERNELS ====================
+
+/**
+ * @brief Batch kernel of a distance callable, see batchDistance.h
+ * @details Specialized for the policies with a batch kernel. The kernels read candidates
+ *          stored row after row, so they run on data that is already contiguous, such as
+ *          the block of a PositionVectorBatch. For any other callable available is false
+ *          and the callable is applied once per row.
+ */
+template<typename Dist>
+struct BatchDistanceKernel {
+    static constexpr bool available = false;
+};
+
+template<>
+struct BatchDistanceKernel<ManhattanDistancePolicy> {
+    static constexpr bool available = true;
+    using Out = int;
+    static void run(const int* reference, const int* candidates, size_t length, size_t count, int* out) {
+        batchManhattanDistance(reference, candidates, length, count, out);
+    }
+};
+
+template<>
+struct BatchDistanceKernel<EuclideanDistancePolicy> {
+    static constexpr bool available = true;
+    using Out = double;
+    static void run(const int* reference, const int* candidates, size_t length, size_t count, double* out) {
+        batchEuclideanDistance(reference, candidates, length, count, out);
+    }
+};
+
+template<>
+struct BatchDistanceKernel<HammingDistancePolicy> {
+    static constexpr bool available = true;
+    using Out = int;
+    static void run(const int* reference, const int* candidates, size_t length, size_t count, int* out) {
+        batchHammingDistance(reference, candidates, length, count, out);
+    }
+};
+
+template<>
+struct BatchDistanceKernel<DifferencePolicy> {
+    static constexpr bool available = true;
+    using Out = int;
+    static void run(const int* reference, const int* candidates, size_t length, size_t count, int* out) {
+        batchDifference(reference, candidates, length, count, out);
+    }
+};
 
+// ==================== TABLE SCORING ====================
+
+/**
+ * @brief Distances from a reference to the vector stored in each row of a table
+ * @tparam VecIndex Tuple index of the vector in a row
+ * @tparam DistIndex Tuple index of the distance, written by this function
+ * @param reference Reference vector
+ * @param rows Table rows
+ * @param distFunc Distance callable, applied to each row with evaluateDistance
+ * @param pool Pool that scores blocks of rows concurrently, nullptr (default) for the
+ *             calling thread
+ * @details The row vectors are stored apart from each other, so they are scored in
+ *          place, one call per row, rather than copied for a batch kernel.
+ *
+ *          With a pool, distFunc is called from several threads at once. It must not
+ *          modify shared state: the policies and distance functions of this header
+ *          are pure. reference and the rows are only read. PositionVector,
+ *          IntervalVector and Vectors (which derives its representations under a lock)
+ *          are safe to read from several threads.
+ */
+template<size_t VecIndex, size_t DistIndex, typename T, typename Row, typename Dist>
+void scoreRows(const T& reference, vector<Row>& rows, const Dist& distFunc, ThreadPool* pool = nullptr) {
+    auto scoreRange = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            get<DistIndex>(rows[i]) = evaluateDistance(distFunc, reference, get<VecIndex>(rows[i]));
+        }
+    };
+    if (pool == nullptr) {
+        scoreRange(0, rows.size());
+    } else {
+        pool->parallelFor(rows.size(), 1024, scoreRange);
+    }
+}
 
 #endif
\ No newline at end of file
@@ -2,6 +2,8 @@
 #define INTERVALVECTOR_H
 
 #include "./mathUtil.h"
+#include "./smallVector.h"
+#include "./vectorExpression.h"
 
 /**
  * @file IntervalVector.h
@@ -26,10 +28,17 @@
  */
 class IntervalVector {
 public:
-    vector<int> data;    ///< Interval vector data
+    VectorData data;    ///< Interval vector data
     int offset;          ///< Offset for translations
     int mod;             ///< Modulo for cyclic operations
 
+    /// Scalar operation node, used by lazy() chains and the componentwise methods
+    template<typename Op>
+    using ScalarExpression = ScalarExpr<VectorLeaf<IntervalVector>, Op>;
+    /// Component-wise operation node, used by lazy() chains and the componentwise methods
+    template<typename Op>
+    using ComponentwiseExpression = ComponentwiseExpr<VectorLeaf<IntervalVector>, Op>;
+
 
     // ==================== CONSTRUCTORS ====================
 
@@ -51,11 +60,34 @@ public:
      * @param newOffset Initial offset, default 0
      * @param newMod Modulo, default 12
      */
-    IntervalVector(const vector<int>& in, int newOffset = 0, int newMod = 12)
+    IntervalVector(const VectorData& in, int newOffset = 0, int newMod = 12)
         : data(in), offset(newOffset), mod(newMod) {}
 
+    /**
+     * @brief Evaluates an arithmetic expression
+     * 
+     * @param expr Expression built from IntervalVector operators
+     * 
+     * @details All elements are computed in a single pass.
+     *          Offset and modulo are taken from the leftmost operand.
+     */
+    template<typename Expr,
+             typename = enable_if_t<IsVectorExpression<Expr, IntervalVector>::value>>
+    IntervalVector(const Expr& expr)
+        : IntervalVector(expr.evaluate(), expr.source().offset, expr.source().mod) {}
+
+    /**
+     * @brief Wraps this vector as the leaf of an arithmetic expression
+     */
+    VectorLeaf<IntervalVector> leaf() const {
+        return VectorLeaf<IntervalVector>(*this);
+    }
+
     // ==================== SCALAR OPERATORS ====================
 
+    // Arithmetic operators return new vectors. To run a chain such as
+    // (v + 3) * 2 % 12 in a single pass, start it with lazy(v), see vectorExpression.h.
+
     /**
      * @brief Adds a scalar to all elements
      * 
@@ -63,11 +95,7 @@ public:
      * @return New IntervalVector with summed values
      */
     IntervalVector operator+(int scalar) const {
-        vector<int> result(data.size());
-        for (size_t i = 0; i < data.size(); ++i) {
-            result[i] = data[i] + scalar;
-        }
-        return IntervalVector(result, offset, mod);
+        return leaf() + scalar;
     }
 
     /**
@@ -77,11 +105,7 @@ public:
      * @return New IntervalVector with subtracted values
      */
     IntervalVector operator-(int scalar) const {
-        vector<int> result(data.size());
-        for (size_t i = 0; i < data.size(); ++i) {
-            result[i] = data[i] - scalar;
-        }
-        return IntervalVector(result, offset, mod);
+        return leaf() - scalar;
     }
 
     /**
@@ -91,11 +115,7 @@ public:
      * @return New IntervalVector with multiplied values
      */
     IntervalVector operator*(int scalar) const {
-        vector<int> result(data.size());
-        for (size_t i = 0; i < data.size(); ++i) {
-            result[i] = data[i] * scalar;
-        }
-        return IntervalVector(result, offset, mod);
+        return leaf() * scalar;
     }
 
     /**
@@ -106,16 +126,7 @@ public:
      * @throw invalid_argument If divisor is 0
      */
     IntervalVector operator/(int divisor) const {
-        if (divisor == 0) {
-            throw invalid_argument("Division by zero");
-        }
-        
-        vector<int> result(data.size());
-        for (size_t i = 0; i < data.size(); ++i) {
-            DivisionResult div = euclideanDivision(data[i], divisor);
-            result[i] = div.quotient;
-        }
-        return IntervalVector(result, offset, mod);
+        return leaf() / divisor;
     }
 
     /**
@@ -126,16 +137,7 @@ public:
      * @throw invalid_argument If divisor is 0
      */
     IntervalVector operator%(int divisor) const {
-        if (divisor == 0) {
-            throw invalid_argument("Division by zero");
-        }
-        
-        vector<int> result(data.size());
-        for (size_t i = 0; i < data.size(); ++i) {
-            DivisionResult div = euclideanDivision(data[i], divisor);
-            result[i] = div.remainder;
-        }
-        return IntervalVector(result, offset, mod);
+        return leaf() % divisor;
     }
 
     // ==================== VECTOR OPERATORS ====================
@@ -149,7 +151,7 @@ public:
      * @note Uses componentwiseSum without looping
      */
     IntervalVector operator+(const IntervalVector& other) const {
-        return componentwiseSum(other.data, false);
+        return leaf() + other;
     }
 
     /**
@@ -161,7 +163,7 @@ public:
      * @note Uses componentwiseSubtraction without looping
      */
     IntervalVector operator-(const IntervalVector& other) const {
-        return componentwiseSubtraction(other.data, false);
+        return leaf() - other;
     }
 
     /**
@@ -173,7 +175,7 @@ public:
      * @note Uses componentwiseProduct with looping
      */
     IntervalVector operator*(const IntervalVector& other) const {
-        return componentwiseProduct(other.data, true);
+        return leaf() * other;
     }
 
     /**
@@ -186,7 +188,7 @@ public:
      * @note Uses componentwiseDivision with looping and Euclidean division
      */
     IntervalVector operator/(const IntervalVector& other) const {
-        return componentwiseDivision(other.data, true);
+        return leaf() / other;
     }
 
     /**
@@ -199,7 +201,7 @@ public:
      * @note Uses componentwiseModulo with looping and Euclidean division
      */
     IntervalVector operator%(const IntervalVector& other) const {
-        return componentwiseModulo(other.data, true);
+        return leaf() % other;
     }
 
     // ==================== OPERATORS WITH VECTOR<INT> ====================
@@ -210,8 +212,8 @@ public:
      * @param other Vector to add
      * @return New IntervalVector result of the addition
      */
-    IntervalVector operator+(const vector<int>& other) const {
-        return componentwiseSum(other, false);
+    IntervalVector operator+(const VectorData& other) const {
+        return leaf() + other;
     }
 
     /**
@@ -220,8 +222,8 @@ public:
      * @param other Vector to subtract
      * @return New IntervalVector result of the subtraction
      */
-    IntervalVector operator-(const vector<int>& other) const {
-        return componentwiseSubtraction(other, false);
+    IntervalVector operator-(const VectorData& other) const {
+        return leaf() - other;
     }
 
     /**
@@ -230,8 +232,8 @@ public:
      * @param other Vector to multiply
      * @return New IntervalVector result of the product
      */
-    IntervalVector operator*(const vector<int>& other) const {
-        return componentwiseProduct(other, true);
+    IntervalVector operator*(const VectorData& other) const {
+        return leaf() * other;
     }
 
     /**
@@ -241,8 +243,8 @@ public:
      * @return New IntervalVector with quotients
      * @throw invalid_argument If other contains zeros
      */
-    IntervalVector operator/(const vector<int>& other) const {
-        return componentwiseDivision(other, true);
+    IntervalVector operator/(const VectorData& other) const {
+        return leaf() / other;
     }
 
     /**
@@ -252,8 +254,8 @@ public:
      * @return New IntervalVector with remainders
      * @throw invalid_argument If other contains zeros
      */
-    IntervalVector operator%(const vector<int>& other) const {
-        return componentwiseModulo(other, true);
+    IntervalVector operator%(const VectorData& other) const {
+        return leaf() % other;
     }
 
     // ==================== COMPOUND ASSIGNMENT OPERATORS ====================
@@ -398,7 +400,7 @@ public:
      * @param other Vector to add
      * @return Reference to this modified object
      */
-    IntervalVector& operator+=(const vector<int>& other) {
+    IntervalVector& operator+=(const VectorData& other) {
         *this = *this + other;
         return *this;
     }
@@ -409,7 +411,7 @@ public:
      * @param other Vector to subtract
      * @return Reference to this modified object
      */
-    IntervalVector& operator-=(const vector<int>& other) {
+    IntervalVector& operator-=(const VectorData& other) {
         *this = *this - other;
         return *this;
     }
@@ -420,7 +422,7 @@ public:
      * @param other Vector to multiply
      * @return Reference to this modified object
      */
-    IntervalVector& operator*=(const vector<int>& other) {
+    IntervalVector& operator*=(const VectorData& other) {
         *this = *this * other;
         return *this;
     }
@@ -432,7 +434,7 @@ public:
      * @return Reference to this modified object
      * @throw invalid_argument If other contains zeros
      */
-    IntervalVector& operator/=(const vector<int>& other) {
+    IntervalVector& operator/=(const VectorData& other) {
         *this = *this / other;
         return *this;
     }
@@ -444,7 +446,7 @@ public:
      * @return Reference to this modified object
      * @throw invalid_argument If other contains zeros
      */
-    IntervalVector& operator%=(const vector<int>& other) {
+    IntervalVector& operator%=(const VectorData& other) {
         *this = *this % other;
         return *this;
     }
@@ -568,7 +570,7 @@ public:
         n = abs(n);
         if (n == 0) n = static_cast<int>(data.size());
         
-        vector<int> out(n);
+        VectorData out(n);
         for (int i = 0; i < n; i++) {
             out[i] = element(r + i);
         }
@@ -592,7 +594,7 @@ IntervalVector rotoTranslate(int r, int n = 0) const {
     int dataSize = static_cast<int>(data.size());
     if (n == 0) n = dataSize;
     
-    vector<int> out(n);
+    VectorData out(n);
     for (int i = 0; i < n; i++) {
         out[i] = element(r + i);
     }
@@ -637,7 +639,7 @@ IntervalVector rotoTranslate(int r, int n = 0) const {
      * @return New IntervalVector with elements in reverse order
      */
     IntervalVector reverse() const {
-        vector<int> out(data.size());
+        VectorData out(data.size());
         for (size_t i = 0; i < data.size(); i++) {
             out[i] = data[(data.size() - 1) - i];
         }
@@ -677,7 +679,7 @@ IntervalVector rotoTranslate(int r, int n = 0) const {
         DivisionResult div = euclideanDivision(axisIndex, size + 1);
         int normalizedAxis = div.remainder;
         
-        vector<int> result = data;
+        VectorData result = data;
         
         // Reverse elements before the axis
         for (int i = 0; i < normalizedAxis / 2; ++i) {
@@ -701,7 +703,7 @@ IntervalVector rotoTranslate(int r, int n = 0) const {
      * @return New IntervalVector with all intervals negated
      */
     IntervalVector negate() const {
-        vector<int> result(data.size());
+        VectorData result(data.size());
         for (size_t i = 0; i < data.size(); ++i) {
             result[i] = -data[i];
         }
@@ -718,7 +720,7 @@ IntervalVector rotoTranslate(int r, int n = 0) const {
         if (modulo == 0) modulo = mod;
         if (modulo == 0) return *this;
         
-        vector<int> result(data.size());
+        VectorData result(data.size());
         for (size_t i = 0; i < data.size(); ++i) {
             DivisionResult div = euclideanDivision(data[i], modulo);
             result[i] = div.remainder;
@@ -732,7 +734,7 @@ IntervalVector rotoTranslate(int r, int n = 0) const {
      * @brief Gets the data vector
      * @return Const reference to the interval vector
      */
-    const vector<int>& getData() const { return data; }
+    const VectorData& getData() const { return data; }
 
     /**
      * @brief Gets the offset
@@ -783,7 +785,7 @@ IntervalVector rotoTranslate(int r, int n = 0) const {
      * 
      * @param newData New interval vector
      */
-    void setData(const vector<int>& newData) {
+    void setData(const VectorData& newData) {
         data = newData;
     }
 
@@ -801,39 +803,11 @@ IntervalVector rotoTranslate(int r, int n = 0) const {
      *          With useLooping=false: adds up to min(size1, size2),
      *          then appends remaining unmodified elements.
      */
-    IntervalVector componentwiseSum(const vector<int>& other, bool useLooping = false) const {
+    IntervalVector componentwiseSum(const VectorData& other, bool useLooping = false) const {
         if (other.empty()) return *this;
         if (data.empty()) return IntervalVector(other, offset, mod);
         
-        vector<int> result;
-        
-        if (useLooping) {
-            size_t maxLength = max(data.size(), other.size());
-            result.reserve(maxLength);
-            
-            for (size_t i = 0; i < maxLength; ++i) {
-                int component1 = data[i % data.size()];
-                int component2 = other[i % other.size()];
-                result.emplace_back(component1 + component2);
-            }
-        } else {
-            size_t minLength = min(data.size(), other.size());
-            result.reserve(max(data.size(), other.size()));
-            
-            for (size_t i = 0; i < minLength; ++i) {
-                result.emplace_back(data[i] + other[i]);
-            }
-            
-            for (size_t i = minLength; i < data.size(); ++i) {
-                result.emplace_back(data[i]);
-            }
-            
-            for (size_t i = minLength; i < other.size(); ++i) {
-                result.emplace_back(other[i]);
-            }
-        }
-        
-        return IntervalVector(result, offset, mod);
+        return ComponentwiseExpression<ExprAdd>(leaf(), other, useLooping);
     }
 
     /**
@@ -843,39 +817,11 @@ IntervalVector rotoTranslate(int r, int n = 0) const {
      * @param useLooping If true, uses cyclic wraparound; if false, extends with non-subtracted elements
      * @return New IntervalVector result of the subtraction
      */
-    IntervalVector componentwiseSubtraction(const vector<int>& other, bool useLooping = false) const {
+    IntervalVector componentwiseSubtraction(const VectorData& other, bool useLooping = false) const {
         if (other.empty()) return *this;
         if (data.empty()) return IntervalVector(other, offset, mod);
         
-        vector<int> result;
-        
-        if (useLooping) {
-            size_t maxLength = max(data.size(), other.size());
-            result.reserve(maxLength);
-            
-            for (size_t i = 0; i < maxLength; ++i) {
-                int component1 = data[i % data.size()];
-                int component2 = other[i % other.size()];
-                result.emplace_back(component1 - component2);
-            }
-        } else {
-            size_t minLength = min(data.size(), other.size());
-            result.reserve(max(data.size(), other.size()));
-            
-            for (size_t i = 0; i < minLength; ++i) {
-                result.emplace_back(data[i] - other[i]);
-            }
-            
-            for (size_t i = minLength; i < data.size(); ++i) {
-                result.emplace_back(data[i]);
-            }
-            
-            for (size_t i = minLength; i < other.size(); ++i) {
-                result.emplace_back(other[i]);
-            }
-        }
-        
-        return IntervalVector(result, offset, mod);
+        return ComponentwiseExpression<ExprSubtract>(leaf(), other, useLooping);
     }
 
     /**
@@ -885,39 +831,11 @@ IntervalVector rotoTranslate(int r, int n = 0) const {
      * @param useLooping If true (default), uses cyclic wraparound
      * @return New IntervalVector result of the product
      */
-    IntervalVector componentwiseProduct(const vector<int>& other, bool useLooping = true) const {
+    IntervalVector componentwiseProduct(const VectorData& other, bool useLooping = true) const {
         if (other.empty()) return IntervalVector({}, offset, mod);
         if (data.empty()) return *this;
         
-        vector<int> result;
-        
-        if (useLooping) {
-            size_t maxLength = max(data.size(), other.size());
-            result.reserve(maxLength);
-            
-            for (size_t i = 0; i < maxLength; ++i) {
-                int component1 = data[i % data.size()];
-                int component2 = other[i % other.size()];
-                result.emplace_back(component1 * component2);
-            }
-        } else {
-            size_t minLength = min(data.size(), other.size());
-            result.reserve(max(data.size(), other.size()));
-            
-            for (size_t i = 0; i < minLength; ++i) {
-                result.emplace_back(data[i] * other[i]);
-            }
-            
-            for (size_t i = minLength; i < data.size(); ++i) {
-                result.emplace_back(data[i]);
-            }
-            
-            for (size_t i = minLength; i < other.size(); ++i) {
-                result.emplace_back(other[i]);
-            }
-        }
-        
-        return IntervalVector(result, offset, mod);
+        return ComponentwiseExpression<ExprMultiply>(leaf(), other, useLooping);
     }
 
     /**
@@ -928,49 +846,13 @@ IntervalVector rotoTranslate(int r, int n = 0) const {
      * @return New IntervalVector with quotients
      * @throw invalid_argument If other is empty or contains zeros
      */
-    IntervalVector componentwiseDivision(const vector<int>& other, bool useLooping = true) const {
+    IntervalVector componentwiseDivision(const VectorData& other, bool useLooping = true) const {
         if (other.empty()) {
             throw invalid_argument("Cannot divide by empty vector");
         }
         if (data.empty()) return *this;
         
-        for (int val : other) {
-            if (val == 0) {
-                throw invalid_argument("Division by zero in componentwise division");
-            }
-        }
-        
-        vector<int> result;
-        
-        if (useLooping) {
-            size_t maxLength = max(data.size(), other.size());
-            result.reserve(maxLength);
-            
-            for (size_t i = 0; i < maxLength; ++i) {
-                int dividend = data[i % data.size()];
-                int divisor = other[i % other.size()];
-                DivisionResult div = euclideanDivision(dividend, divisor);
-                result.emplace_back(div.quotient);
-            }
-        } else {
-            size_t minLength = min(data.size(), other.size());
-            result.reserve(max(data.size(), other.size()));
-            
-            for (size_t i = 0; i < minLength; ++i) {
-                DivisionResult div = euclideanDivision(data[i], other[i]);
-                result.emplace_back(div.quotient);
-            }
-            
-            for (size_t i = minLength; i < data.size(); ++i) {
-                result.emplace_back(data[i]);
-            }
-            
-            for (size_t i = minLength; i < other.size(); ++i) {
-                result.emplace_back(other[i]);
-            }
-        }
-        
-        return IntervalVector(result, offset, mod);
+        return ComponentwiseExpression<ExprDivide>(leaf(), other, useLooping);
     }
 
     /**
@@ -981,49 +863,13 @@ IntervalVector rotoTranslate(int r, int n = 0) const {
      * @return New IntervalVector with remainders
      * @throw invalid_argument If other is empty or contains zeros
      */
-    IntervalVector componentwiseModulo(const vector<int>& other, bool useLooping = true) const {
+    IntervalVector componentwiseModulo(const VectorData& other, bool useLooping = true) const {
         if (other.empty()) {
             throw invalid_argument("Cannot compute modulo with empty vector");
         }
         if (data.empty()) return *this;
         
-        for (int val : other) {
-            if (val == 0) {
-                throw invalid_argument("Division by zero in componentwise modulo");
-            }
-        }
-        
-        vector<int> result;
-        
-        if (useLooping) {
-            size_t maxLength = max(data.size(), other.size());
-            result.reserve(maxLength);
-            
-            for (size_t i = 0; i < maxLength; ++i) {
-                int dividend = data[i % data.size()];
-                int divisor = other[i % other.size()];
-                DivisionResult div = euclideanDivision(dividend, divisor);
-                result.emplace_back(div.remainder);
-            }
-        } else {
-            size_t minLength = min(data.size(), other.size());
-            result.reserve(max(data.size(), other.size()));
-            
-            for (size_t i = 0; i < minLength; ++i) {
-                DivisionResult div = euclideanDivision(data[i], other[i]);
-                result.emplace_back(div.remainder);
-            }
-            
-            for (size_t i = minLength; i < data.size(); ++i) {
-                result.emplace_back(data[i]);
-            }
-            
-            for (size_t i = minLength; i < other.size(); ++i) {
-                result.emplace_back(other[i]);
-            }
-        }
-        
-        return IntervalVector(result, offset, mod);
+        return ComponentwiseExpression<ExprModulo>(leaf(), other, useLooping);
     }
 
     // ==================== STATIC METHODS ====================
@@ -1077,7 +923,7 @@ IntervalVector rotoTranslate(int r, int n = 0) const {
             int scaleFactor = lcm / iv.mod;
             
             // Scale the data
-            vector<int> scaledData(iv.data.size());
+            VectorData scaledData(iv.data.size());
             for (size_t i = 0; i < iv.data.size(); ++i) {
                 scaledData[i] = iv.data[i] * scaleFactor;
             }
@@ -1100,7 +946,7 @@ IntervalVector rotoTranslate(int r, int n = 0) const {
      * @return New IntervalVector with all elements
      */
     IntervalVector concatenate(const IntervalVector& other) const {
-        vector<int> result = data;
+        VectorData result = data;
         result.insert(result.end(), other.data.begin(), other.data.end());
         return IntervalVector(result, offset, mod);
     }
@@ -1114,7 +960,7 @@ IntervalVector rotoTranslate(int r, int n = 0) const {
     IntervalVector repeat(int times) const {
         if (times <= 0) return IntervalVector({}, offset, mod);
         
-        vector<int> result;
+        VectorData result;
         result.reserve(data.size() * times);
         
         for (int t = 0; t < times; ++t) {
@@ -1139,7 +985,7 @@ IntervalVector rotoTranslate(int r, int n = 0) const {
      * @note If position is out of range [0, size], returns an unmodified copy
      */
     IntervalVector singleMirror(int position, bool left) const {
-        vector<int> out = data;
+        VectorData out = data;
         int length = static_cast<int>(out.size());
 
         if (position < 0 || position > length) {
@@ -1173,7 +1019,7 @@ IntervalVector rotoTranslate(int r, int n = 0) const {
      * @note If position is out of range [0, size], returns an unmodified copy
      */
     IntervalVector doubleMirror(int position) const {
-        vector<int> out = data;
+        VectorData out = data;
         int length = static_cast<int>(out.size());
 
         if (position < 0 || position > length) {
@@ -1208,7 +1054,7 @@ IntervalVector rotoTranslate(int r, int n = 0) const {
      * @note If position is out of range, returns an unmodified copy
      */
     IntervalVector crossMirror(int position, bool left) const {
-        vector<int> out = data;
+        VectorData out = data;
         int n = static_cast<int>(data.size());
 
         if (left) {
@@ -1273,4 +1119,22 @@ IntervalVector rotoTranslate(int r, int n = 0) const {
     }
 };
 
+/**
+ * @brief Starts a fused arithmetic chain on an IntervalVector
+ * @return Expression referring to v; v must outlive it
+ * @details `IntervalVector r = lazy(v) + 3;` computes the whole chain in one pass when it is
+ *          converted to an IntervalVector. See vectorExpression.h.
+ */
+inline VectorLeaf<IntervalVector> lazy(const IntervalVector& v) {
+    return v.leaf();
+}
+
+/**
+ * @brief Starts a fused arithmetic chain on a temporary IntervalVector
+ * @return Expression owning the vector, safe to keep after the full expression
+ */
+inline OwnedVectorLeaf<IntervalVector> lazy(IntervalVector&& v) {
+    return OwnedVectorLeaf<IntervalVector>(move(v));
+}
+
 #endif // INTERVALVECTOR_H
@@ -32,7 +32,7 @@ struct DivisionResult {
  * @param divisor The divisor (number to divide by)
  * @return DivisionResult Structure containing quotient and remainder
  */
-DivisionResult euclideanDivision(int dividend, int divisor) {
+constexpr DivisionResult euclideanDivision(int dividend, int divisor) {
     // Standard division
     int quotient = dividend / divisor;
     int remainder = dividend - quotient * divisor;
@@ -52,7 +52,7 @@ DivisionResult euclideanDivision(int dividend, int divisor) {
      * @param b Second number
      * @return int GCD of a and b
      */
-    static int GCD(int a, int b) {
+    inline int GCD(int a, int b) {
         if (b == 0) return abs(a);
         return GCD(b, a % b);
     }
@@ -63,7 +63,7 @@ DivisionResult euclideanDivision(int dividend, int divisor) {
      * @param values Vector of values for which to calculate the LCM
      * @return int LCM of all values
      */
-    static int LCM(const vector<int>& values) {
+    inline int LCM(const vector<int>& values) {
         if (values.empty()) return 1;
         if (values.size() == 1) return abs(values[0]);
         
@@ -364,6 +364,251 @@ public:
     }
 };
 
+// ==================== LAZY MATRIX VIEWS ====================
+
+/**
+ * @brief Input iterator over the rows of a lazy matrix view
+ * @tparam View View type providing size() and row(i)
+ * @details Dereferencing computes the row, so the iterator yields values, not references.
+ */
+template<typename View>
+class MatrixViewIterator {
+private:
+    const View* view_;
+    size_t index_;
+
+public:
+    using iterator_category = input_iterator_tag;
+    using value_type = typename View::value_type;
+    using difference_type = ptrdiff_t;
+    using pointer = void;
+    using reference = value_type;
+
+    MatrixViewIterator(const View* view, size_t index) : view_(view), index_(index) {}
+
+    value_type operator*() const { return view_->row(index_); }
+
+    MatrixViewIterator& operator++() { ++index_; return *this; }
+    MatrixViewIterator operator++(int) { MatrixViewIterator tmp = *this; ++index_; return tmp; }
+
+    bool operator==(const MatrixViewIterator& other) const { return index_ == other.index_; }
+    bool operator!=(const MatrixViewIterator& other) const { return index_ != other.index_; }
+};
+
+/**
+ * @brief Common read-only interface of the lazy matrix views
+ * @tparam Derived View type providing size() and row(i)
+ * @tparam T Type of the row vectors
+ * @details Rows are computed on access and never stored, so scans and filters over a
+ *          view only hold one row at a time. materialize() produces the equivalent
+ *          concrete matrix.
+ */
+template<typename Derived, typename T>
+class MatrixView {
+protected:
+    const Derived& self() const { return static_cast<const Derived&>(*this); }
+
+public:
+    using vector_type = T;
+    using value_type = pair<T, int>;
+    using const_iterator = MatrixViewIterator<Derived>;
+
+    bool empty() const { return self().size() == 0; }
+
+    value_type operator[](size_t i) const { return self().row(i); }
+
+    value_type at(size_t i) const {
+        if (i >= self().size()) {
+            throw out_of_range("Matrix view index out of range");
+        }
+        return self().row(i);
+    }
+
+    // Iterator support
+    const_iterator begin() const { return const_iterator(&self(), 0); }
+    const_iterator end() const { return const_iterator(&self(), self().size()); }
+
+    // Compute all the rows
+    vector<value_type> getData() const {
+        vector<value_type> result;
+        result.reserve(self().size());
+        for (size_t i = 0; i < self().size(); ++i) {
+            result.emplace_back(self().row(i));
+        }
+        return result;
+    }
+
+    // Get only the vectors (without indices)
+    vector<T> getVectors() const {
+        vector<T> result;
+        result.reserve(self().size());
+        for (size_t i = 0; i < self().size(); ++i) {
+            result.emplace_back(self().row(i).first);
+        }
+        return result;
+    }
+
+    // Get only the indices (without computing the rows)
+    vector<int> getIndices() const {
+        vector<int> result;
+        result.reserve(self().size());
+        for (size_t i = 0; i < self().size(); ++i) {
+            result.emplace_back(self().index(i));
+        }
+        return result;
+    }
+};
+
+/**
+ * @brief Lazy modal matrix: row i is the i-th rotation of the generator
+ * @tparam T IntervalVector or PositionVector
+ * @details The generator is stored once as intervals; PositionVector rows are
+ *          converted back to positions on access.
+ */
+template<typename T>
+class ModalMatrixView : public MatrixView<ModalMatrixView<T>, T> {
+private:
+    IntervalVector intervals_;
+
+public:
+    explicit ModalMatrixView(const IntervalVector& intervals) : intervals_(intervals) {}
+
+    size_t size() const { return intervals_.size(); }
+    int index(size_t i) const { return static_cast<int>(i); }
+
+    pair<T, int> row(size_t i) const {
+        IntervalVector rotated = intervals_.rotate(static_cast<int>(i));
+        if constexpr (is_same<T, PositionVector>::value) {
+            return make_pair(intervalsToPositions(rotated), index(i));
+        } else {
+            return make_pair(rotated, index(i));
+        }
+    }
+
+    // Compute all the rows into a ModalMatrix
+    ModalMatrix<T> materialize() const { return ModalMatrix<T>(this->getData()); }
+
+    friend ostream& operator<<(ostream& os, const ModalMatrixView<T>& mm) {
+        os << setw(6) << "Row" << " | " << setw(4) << "Mode" << " | Vector\n";
+        os << string(60, '-') << "\n";
+        for (size_t i = 0; i < mm.size(); ++i) {
+            os << setw(6) << i + 1 << " | " << setw(4) << mm.index(i) << " | " << mm.row(i).first << "\n";
+        }
+        return os;
+    }
+};
+
+/**
+ * @brief Lazy transposition matrix: row i is the sorted transposition by i modulo mod
+ */
+class TranspositionMatrixView : public MatrixView<TranspositionMatrixView, PositionVector> {
+private:
+    PositionVector source_;
+
+public:
+    explicit TranspositionMatrixView(const PositionVector& source) : source_(source) {}
+
+    size_t size() const { return static_cast<size_t>(max(source_.getMod(), 0)); }
+    int index(size_t i) const { return static_cast<int>(i); }
+
+    pair<PositionVector, int> row(size_t i) const {
+        int n = source_.getMod();
+        PositionVector transposed = (source_ + index(i)) % n;
+        sort(transposed.data.begin(), transposed.data.end());
+        return make_pair(transposed, index(i));
+    }
+
+    // Get only the transposition indices
+    vector<int> getTranspositions() const { return getIndices(); }
+
+    // Compute all the rows into a TranspositionMatrix
+    TranspositionMatrix materialize() const { return TranspositionMatrix(getData()); }
+
+    friend ostream& operator<<(ostream& os, const TranspositionMatrixView& tm) {
+        os << setw(6) << "Row" << " | " << setw(4) << "Transposition" << " | Vector\n";
+        os << string(60, '-') << "\n";
+        for (size_t i = 0; i < tm.size(); ++i) {
+            os << setw(6) << i << " | " << setw(4) << tm.index(i) << " | " << tm.row(i).first << "\n";
+        }
+        return os;
+    }
+};
+
+/**
+ * @brief Lazy rototranslation matrix: rows are rotoTranslate(t) for t in [center - n, center + n]
+ */
+class RototranslationMatrixView : public MatrixView<RototranslationMatrixView, PositionVector> {
+private:
+    PositionVector source_;
+    int center_;
+
+public:
+    RototranslationMatrixView(const PositionVector& source, int center = 0)
+        : source_(source), center_(center) {}
+
+    size_t size() const { return 2 * source_.size() + 1; }
+    int index(size_t i) const { return center_ - static_cast<int>(source_.size()) + static_cast<int>(i); }
+
+    pair<PositionVector, int> row(size_t i) const {
+        return make_pair(source_.rotoTranslate(index(i)), index(i));
+    }
+
+    // Get the center used for rototranslation
+    int getCenter() const { return center_; }
+
+    // Get only the translation indices
+    vector<int> getTranslations() const { return getIndices(); }
+
+    // Compute all the rows into a RototranslationMatrix
+    RototranslationMatrix materialize() const { return RototranslationMatrix(getData(), center_); }
+
+    friend ostream& operator<<(ostream& os, const RototranslationMatrixView& rtm) {
+        os << setw(6) << "Row" << " | " << setw(4) << "Position" << " | Vector\n";
+        os << string(60, '-') << "\n";
+        for (size_t i = 0; i < rtm.size(); ++i) {
+            os << setw(6) << i << " | " << setw(4) << rtm.index(i) << " | " << rtm.row(i).first << "\n";
+        }
+        return os;
+    }
+};
+
+/**
+ * @brief Lazy modal matrix of an IntervalVector
+ * @param iv Input IntervalVector
+ * @return ModalMatrixView computing the rotations on access
+ */
+ModalMatrixView<IntervalVector> modalMatrixView(const IntervalVector& iv) {
+    return ModalMatrixView<IntervalVector>(iv);
+}
+
+/**
+ * @brief Lazy modal matrix of a PositionVector
+ * @param pv Input PositionVector
+ * @return ModalMatrixView computing the rotations on access
+ */
+ModalMatrixView<PositionVector> modalMatrixView(const PositionVector& pv) {
+    return ModalMatrixView<PositionVector>(positionsToIntervals(pv));
+}
+
+/**
+ * @brief Lazy transposition matrix of a PositionVector
+ * @param pv Input PositionVector
+ * @return TranspositionMatrixView computing the transpositions on access
+ */
+TranspositionMatrixView transpositionMatrixView(const PositionVector& pv) {
+    return TranspositionMatrixView(pv);
+}
+
+/**
+ * @brief Lazy rototranslation matrix of a PositionVector
+ * @param pv Input PositionVector
+ * @param center Center position for rototranslation
+ * @return RototranslationMatrixView computing the rototranslations on access
+ */
+RototranslationMatrixView rototranslationMatrixView(const PositionVector& pv, int center) {
+    return RototranslationMatrixView(pv, center);
+}
+
 // ==================== MATRIX GENERATION FUNCTIONS ====================
 
 /**
@@ -373,16 +618,7 @@ public:
  * @details Each row is a rotation of the input IntervalVector.  
  */ 
 ModalMatrix<IntervalVector> modalMatrix(IntervalVector iv) {
-    int n = iv.size();
-    vector<pair<IntervalVector, int>> matrix;
-    matrix.reserve(n);
-    
-    for (int i = 0; i < n; ++i) {
-        IntervalVector rotated = iv.rotate(i);
-        matrix.emplace_back(make_pair(rotated, i));
-    }
-    
-    return ModalMatrix<IntervalVector>(matrix);
+    return modalMatrixView(iv).materialize();
 }
 
 /**
@@ -396,14 +632,7 @@ ModalMatrix<IntervalVector> modalMatrix(IntervalVector iv) {
  *         The center can be any integer, allowing for flexible translation.
  */
 RototranslationMatrix rototranslationMatrix(PositionVector& in, int center) {
-    vector<pair<PositionVector, int>> matrix;
-    int n = in.size();
-
-    for (int i = center - n; i < center + n+1; i++) {
-        PositionVector row = in.rotoTranslate(i);
-        matrix.emplace_back(make_pair(row, i));
-    }
-    return RototranslationMatrix(matrix, center);
+    return rototranslationMatrixView(in, center).materialize();
 }
 
 /**
@@ -413,21 +642,11 @@ RototranslationMatrix rototranslationMatrix(PositionVector& in, int center) {
  * @details Each row is a rotation of the input PositionVector.
  *         The rotation index indicates the amount of rotation applied.
  *         The number of rows is determined by the size of the input vector.
- *         Internally converts the PositionVector to an IntervalVector for rotation,
- *         then back to PositionVector.
+ *         Each rotation is computed on the intervals of the input and converted
+ *         back to positions, without building the interval matrix first.
  */
 ModalMatrix<PositionVector> modalMatrix(PositionVector pv) {
-    IntervalVector iv = positionsToIntervals(pv);
-    ModalMatrix<IntervalVector> ivMatrix = modalMatrix(iv);
-    
-    vector<pair<PositionVector, int>> pvMatrix;
-    pvMatrix.reserve(ivMatrix.size());
-    for (size_t i = 0; i < ivMatrix.size(); ++i) {
-        PositionVector posVec = intervalsToPositions(ivMatrix[i].first);
-        pvMatrix.emplace_back(make_pair(posVec, ivMatrix[i].second));
-    }
-
-    return ModalMatrix<PositionVector>(pvMatrix);
+    return modalMatrixView(pv).materialize();
 }
 
 /**
@@ -441,17 +660,7 @@ ModalMatrix<PositionVector> modalMatrix(PositionVector pv) {
  *         The resulting PositionVectors are sorted in ascending order for consistency.
  */
 TranspositionMatrix transpositionMatrix(PositionVector pv) {
-    int n = pv.getMod();
-    vector<pair<PositionVector, int>> matrix;
-    matrix.reserve(n);
-    
-    for (int i = 0; i < n; ++i) {
-        PositionVector transposed = (pv + i) % n;
-        sort(transposed.data.begin(), transposed.data.end());
-        matrix.emplace_back(make_pair(transposed, i));
-    }
-    
-    return TranspositionMatrix(matrix);
+    return transpositionMatrixView(pv).materialize();
 }
 
 /**
@@ -539,6 +748,37 @@ ModalRototranslationMatrix<PositionVector> modalRototranslation(
     return ModalRototranslationMatrix<PositionVector>(result);
 }
 
+/**
+ * @brief Checks whether a PositionVector contains all the given notes modulo its modulo
+ * @param pv PositionVector to check
+ * @param notes Vector of MIDI note numbers
+ * @return true if every note's pitch class appears in pv
+ * @details For moduli up to 64 both sides become PitchClassMasks and the check is a
+ *          single subset test; larger moduli fall back to a linear search per note.
+ */
+bool containsAllPitchClasses(const PositionVector& pv, const vector<int>& notes) {
+    int mod = pv.getMod();
+    
+    if (mod >= 1 && mod <= PitchClassMask::MAX_MOD) {
+        return PitchClassMask(notes, mod).isSubsetOf(PitchClassMask(pv.data, mod));
+    }
+    
+    for (int note : notes) {
+        int note_mod = ((note % mod) + mod) % mod; // Euclidean modulo
+        
+        bool found = false;
+        for (int pos : pv.data) {
+            if (((pos % mod) + mod) % mod == note_mod) {
+                found = true;
+                break;
+            }
+        }
+        
+        if (!found) return false;
+    }
+    return true;
+}
+
 /**
  * @brief Filters a ModalMatrix<PositionVector> to keep only rows containing all specified MIDI notes
  * @param matrix Input ModalMatrix<PositionVector>
@@ -560,29 +800,8 @@ ModalMatrix<PositionVector> filterModalMatrix(
     for (size_t i = 0; i < matrix.size(); ++i) {
         const PositionVector& pv = matrix[i].first;
         int mode_idx = matrix[i].second;
-        int mod = pv.getMod();
-        
-        // Check if this row contains all required notes (modulo mod)
-        bool contains_all = true;
-        for (int note : notes) {
-            int note_mod = ((note % mod) + mod) % mod; // Euclidean modulo
-            
-            // Check if note_mod exists in this PositionVector
-            bool found = false;
-            for (int pos : pv.data) {
-                if (((pos % mod) + mod) % mod == note_mod) {
-                    found = true;
-                    break;
-                }
-            }
-            
-            if (!found) {
-                contains_all = false;
-                break;
-            }
-        }
         
-        if (contains_all) {
+        if (containsAllPitchClasses(pv, notes)) {
             filtered.emplace_back(make_pair(pv, mode_idx));
         }
     }
@@ -611,29 +830,8 @@ TranspositionMatrix filterTranspositionMatrix(
     for (size_t i = 0; i < matrix.size(); ++i) {
         const PositionVector& pv = matrix[i].first;
         int trans_idx = matrix[i].second;
-        int mod = pv.getMod();
         
-        // Check if this row contains all required notes (modulo mod)
-        bool contains_all = true;
-        for (int note : notes) {
-            int note_mod = ((note % mod) + mod) % mod; // Euclidean modulo
-            
-            // Check if note_mod exists in this PositionVector
-            bool found = false;
-            for (int pos : pv.data) {
-                if (((pos % mod) + mod) % mod == note_mod) {
-                    found = true;
-                    break;
-                }
-            }
-            
-            if (!found) {
-                contains_all = false;
-                break;
-            }
-        }
-        
-        if (contains_all) {
+        if (containsAllPitchClasses(pv, notes)) {
             filtered.emplace_back(make_pair(pv, trans_idx));
         }
     }
@@ -641,6 +839,52 @@ TranspositionMatrix filterTranspositionMatrix(
     return TranspositionMatrix(filtered);
 }
 
+/**
+ * @brief Filters a lazy modal matrix to the rows containing all specified MIDI notes
+ * @param matrix Input ModalMatrixView<PositionVector>
+ * @param notes Vector of MIDI note numbers to check for
+ * @return ModalMatrix<PositionVector> holding only the matching rows
+ * @details Rows are computed one at a time; only the matches are stored.
+ */
+ModalMatrix<PositionVector> filterModalMatrix(
+    const ModalMatrixView<PositionVector>& matrix, 
+    const vector<int>& notes)
+{
+    vector<pair<PositionVector, int>> filtered;
+    
+    for (size_t i = 0; i < matrix.size(); ++i) {
+        pair<PositionVector, int> row = matrix[i];
+        if (containsAllPitchClasses(row.first, notes)) {
+            filtered.emplace_back(move(row));
+        }
+    }
+    
+    return ModalMatrix<PositionVector>(filtered);
+}
+
+/**
+ * @brief Filters a lazy transposition matrix to the rows containing all specified MIDI notes
+ * @param matrix Input TranspositionMatrixView
+ * @param notes Vector of MIDI note numbers to check for
+ * @return TranspositionMatrix holding only the matching rows
+ * @details Rows are computed one at a time; only the matches are stored.
+ */
+TranspositionMatrix filterTranspositionMatrix(
+    const TranspositionMatrixView& matrix, 
+    const vector<int>& notes)
+{
+    vector<pair<PositionVector, int>> filtered;
+    
+    for (size_t i = 0; i < matrix.size(); ++i) {
+        pair<PositionVector, int> row = matrix[i];
+        if (containsAllPitchClasses(row.first, notes)) {
+            filtered.emplace_back(move(row));
+        }
+    }
+    
+    return TranspositionMatrix(filtered);
+}
+
 /**
  * @brief In-place filters a ModalMatrix<PositionVector> to keep only rows containing all specified MIDI notes
  * @param matrix ModalMatrix<PositionVector> to be modified
@@ -11,7 +11,8 @@
  * @date 2025
  * @details This file contains classes and functions to compute distances between a reference vector
  *          and all rows in various matrix types, storing the results with distance metrics and
- *          providing sorting capabilities.
+ *          providing sorting capabilities. When only one rank or the k closest rows are needed,
+ *          selectByComplexity and calculateClosestDistances avoid storing and sorting every row.
  */
 
 
@@ -690,28 +691,86 @@ using DistanceFuncPV = int (*)(PositionVector, PositionVector);
  */
 using DistanceFuncIV = int (*)(IntervalVector, IntervalVector);
 
+/**
+ * @brief Type alias for distance function pointer for PositionVector taken by reference
+ * @details Signature of the library distance functions, default of the templated algorithms.
+ */
+using DistanceFuncRefPV = int (*)(const PositionVector&, const PositionVector&);
+
+/**
+ * @brief Type alias for distance function pointer for IntervalVector taken by reference
+ */
+using DistanceFuncRefIV = int (*)(const IntervalVector&, const IntervalVector&);
+
+template<typename T>
+struct NonDeducedType { using type = T; };
+
+/**
+ * @brief Type alias for distance function pointer for a vector type deduced elsewhere
+ * @details T is not deduced from this parameter, so overloaded functions such as
+ *          manhattanDistance can be passed directly.
+ */
+template<typename T>
+using DistanceFunc = int (*)(typename NonDeducedType<T>::type, typename NonDeducedType<T>::type);
+
+/**
+ * @brief Type alias for distance function pointer for a vector type deduced elsewhere, taken by reference
+ * @see DistanceFunc
+ */
+template<typename T>
+using DistanceFuncRef = int (*)(const typename NonDeducedType<T>::type&, const typename NonDeducedType<T>::type&);
+
+/**
+ * @brief Builds the rows of a distance table
+ * @param count Number of rows
+ * @param pool Pool to build them on, or nullptr for the calling thread
+ * @param makeRow Callable returning row i; on a pool it is called concurrently
+ * @return Rows in index order
+ * @details makeRow only reads the matrix. Stored matrices and the lazy views of
+ *          matrix.h compute a row from const state, so they can be read by several
+ *          threads at once.
+ */
+template<typename Row, typename MakeRow>
+vector<Row> buildDistanceRows(size_t count, ThreadPool* pool, MakeRow makeRow) {
+    vector<Row> rows;
+    if (pool == nullptr) {
+        rows.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            rows.push_back(makeRow(i));
+        }
+        return rows;
+    }
+    rows.resize(count);
+    pool->parallelFor(count, 256, [&rows, &makeRow](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            rows[i] = makeRow(i);
+        }
+    });
+    return rows;
+}
+
 /**
  * @brief Calculates distances between a reference PositionVector and a ModalMatrix
  * @param reference Reference PositionVector to compare against
  * @param matrix Input ModalMatrix
  * @param distFunc Distance function to use
  * @param sort If true, sort results by distance (default: true)
+ * @param pool Pool that builds and scores the rows, nullptr (default) runs on the calling thread
  * @return ModalMatrixDistance with computed distances
  */
+template<typename Dist = DistanceFuncRefPV>
 ModalMatrixDistance<PositionVector> calculateDistances(
     const PositionVector& reference,
     const ModalMatrix<PositionVector>& matrix,
-    DistanceFuncPV distFunc = manhattanDistance,
-    bool sort = true)
+    Dist distFunc = manhattanDistance,
+    bool sort = true,
+    ThreadPool* pool = nullptr)
 {
-    vector<tuple<PositionVector, int, double>> result;
-    result.reserve(matrix.size());
-    
-    for (size_t i = 0; i < matrix.size(); ++i) {
+    auto result = buildDistanceRows<tuple<PositionVector, int, double>>(matrix.size(), pool, [&matrix](size_t i) {
         const auto& [vec, idx] = matrix[i];
-        double dist = distFunc(reference, vec);
-        result.emplace_back(make_tuple(vec, idx, dist));
-    }
+        return make_tuple(vec, idx, 0.0);
+    });
+    scoreRows<0, 2>(reference, result, distFunc, pool);
     
     auto mmd = ModalMatrixDistance<PositionVector>(result);
     if (sort) {
@@ -726,22 +785,22 @@ ModalMatrixDistance<PositionVector> calculateDistances(
  * @param matrix Input ModalMatrix
  * @param distFunc Distance function to use
  * @param sort If true, sort results by distance (default: true)
+ * @param pool Pool that builds and scores the rows, nullptr (default) runs on the calling thread
  * @return ModalMatrixDistance with computed distances
  */
+template<typename Dist = DistanceFuncRefIV>
 ModalMatrixDistance<IntervalVector> calculateDistances(
     const IntervalVector& reference,
     const ModalMatrix<IntervalVector>& matrix,
-    DistanceFuncIV distFunc = manhattanDistance,
-    bool sort = true)
+    Dist distFunc = manhattanDistance,
+    bool sort = true,
+    ThreadPool* pool = nullptr)
 {
-    vector<tuple<IntervalVector, int, double>> result;
-    result.reserve(matrix.size());
-    
-    for (size_t i = 0; i < matrix.size(); ++i) {
+    auto result = buildDistanceRows<tuple<IntervalVector, int, double>>(matrix.size(), pool, [&matrix](size_t i) {
         const auto& [vec, idx] = matrix[i];
-        double dist = distFunc(reference, vec);
-        result.emplace_back(make_tuple(vec, idx, dist));
-    }
+        return make_tuple(vec, idx, 0.0);
+    });
+    scoreRows<0, 2>(reference, result, distFunc, pool);
     
     auto mmd = ModalMatrixDistance<IntervalVector>(result);
     if (sort) {
@@ -756,22 +815,22 @@ ModalMatrixDistance<IntervalVector> calculateDistances(
  * @param matrix Input TranspositionMatrix
  * @param distFunc Distance function to use
  * @param sort If true, sort results by distance (default: true)
+ * @param pool Pool that builds and scores the rows, nullptr (default) runs on the calling thread
  * @return TranspositionMatrixDistance with computed distances
  */
+template<typename Dist = DistanceFuncRefPV>
 TranspositionMatrixDistance calculateDistances(
     const PositionVector& reference,
     const TranspositionMatrix& matrix,
-    DistanceFuncPV distFunc = manhattanDistance,
-    bool sort = true)
+    Dist distFunc = manhattanDistance,
+    bool sort = true,
+    ThreadPool* pool = nullptr)
 {
-    vector<tuple<PositionVector, int, double>> result;
-    result.reserve(matrix.size());
-    
-    for (size_t i = 0; i < matrix.size(); ++i) {
+    auto result = buildDistanceRows<tuple<PositionVector, int, double>>(matrix.size(), pool, [&matrix](size_t i) {
         const auto& [vec, idx] = matrix[i];
-        double dist = distFunc(reference, vec);
-        result.emplace_back(make_tuple(vec, idx, dist));
-    }
+        return make_tuple(vec, idx, 0.0);
+    });
+    scoreRows<0, 2>(reference, result, distFunc, pool);
     
     auto tmd = TranspositionMatrixDistance(result);
     if (sort) {
@@ -780,7 +839,7 @@ TranspositionMatrixDistance calculateDistances(
     return tmd;
 }
 
-int align(PositionVector reference, PositionVector target){
+int align(const PositionVector& reference, const PositionVector& target){
   int minV = reference[0];
   DivisionResult referenceDiv = euclideanDivision(reference[0], reference.range);
   DivisionResult targetDiv = euclideanDivision(target[0], target.range);
@@ -805,22 +864,114 @@ int align(PositionVector reference, PositionVector target){
  * @param matrix Input RototranslationMatrix
  * @param distFunc Distance function to use
  * @param sort If true, sort results by distance (default: true)
+ * @param pool Pool that builds and scores the rows, nullptr (default) runs on the calling thread
  * @return RototranslationMatrixDistance with computed distances
  */
+template<typename Dist = DistanceFuncRefPV>
 RototranslationMatrixDistance calculateDistances(
     const PositionVector& reference,
     const RototranslationMatrix& matrix,
-    DistanceFuncPV distFunc = manhattanDistance,
-    bool sort = true)
+    Dist distFunc = manhattanDistance,
+    bool sort = true,
+    ThreadPool* pool = nullptr)
 {
-    vector<tuple<PositionVector, int, double>> result;
-    result.reserve(matrix.size());
-    
-    for (size_t i = 0; i < matrix.size(); ++i) {
+    auto result = buildDistanceRows<tuple<PositionVector, int, double>>(matrix.size(), pool, [&matrix](size_t i) {
         const auto& [vec, idx] = matrix[i];
-        double dist = distFunc(reference, vec);
-        result.emplace_back(make_tuple(vec, idx, dist));
+        return make_tuple(vec, idx, 0.0);
+    });
+    scoreRows<0, 2>(reference, result, distFunc, pool);
+    auto rmd = RototranslationMatrixDistance(result, matrix.getCenter());
+    if (sort) {
+        rmd.sortByDistance();
+    }
+    return rmd;
+}
+
+// ==================== LAZY MATRIX VIEWS ====================
+
+/**
+ * @brief Calculates distances between a reference and a lazy modal matrix
+ * @param reference Reference vector to compare against
+ * @param matrix Input ModalMatrixView
+ * @param distFunc Distance function to use
+ * @param sort If true, sort results by distance (default: true)
+ * @param pool Pool that builds and scores the rows, nullptr (default) runs on the calling thread
+ * @return ModalMatrixDistance with computed distances
+ * @details Rows are computed one at a time and never stored as a matrix.
+ */
+template<typename T, typename Dist = DistanceFuncRef<T>>
+ModalMatrixDistance<T> calculateDistances(
+    const T& reference,
+    const ModalMatrixView<T>& matrix,
+    Dist distFunc = manhattanDistance,
+    bool sort = true,
+    ThreadPool* pool = nullptr)
+{
+    auto result = buildDistanceRows<tuple<T, int, double>>(matrix.size(), pool, [&matrix](size_t i) {
+        auto [vec, idx] = matrix[i];
+        return make_tuple(move(vec), idx, 0.0);
+    });
+    scoreRows<0, 2>(reference, result, distFunc, pool);
+    
+    auto mmd = ModalMatrixDistance<T>(result);
+    if (sort) {
+        mmd.sortByDistance();
+    }
+    return mmd;
+}
+
+/**
+ * @brief Calculates distances between a reference PositionVector and a lazy transposition matrix
+ * @param reference Reference PositionVector to compare against
+ * @param matrix Input TranspositionMatrixView
+ * @param distFunc Distance function to use
+ * @param sort If true, sort results by distance (default: true)
+ * @param pool Pool that builds and scores the rows, nullptr (default) runs on the calling thread
+ * @return TranspositionMatrixDistance with computed distances
+ */
+template<typename Dist = DistanceFuncRefPV>
+TranspositionMatrixDistance calculateDistances(
+    const PositionVector& reference,
+    const TranspositionMatrixView& matrix,
+    Dist distFunc = manhattanDistance,
+    bool sort = true,
+    ThreadPool* pool = nullptr)
+{
+    auto result = buildDistanceRows<tuple<PositionVector, int, double>>(matrix.size(), pool, [&matrix](size_t i) {
+        auto [vec, idx] = matrix[i];
+        return make_tuple(move(vec), idx, 0.0);
+    });
+    scoreRows<0, 2>(reference, result, distFunc, pool);
+    
+    auto tmd = TranspositionMatrixDistance(result);
+    if (sort) {
+        tmd.sortByDistance();
     }
+    return tmd;
+}
+
+/**
+ * @brief Calculates distances between a reference PositionVector and a lazy rototranslation matrix
+ * @param reference Reference PositionVector to compare against
+ * @param matrix Input RototranslationMatrixView
+ * @param distFunc Distance function to use
+ * @param sort If true, sort results by distance (default: true)
+ * @param pool Pool that builds and scores the rows, nullptr (default) runs on the calling thread
+ * @return RototranslationMatrixDistance with computed distances
+ */
+template<typename Dist = DistanceFuncRefPV>
+RototranslationMatrixDistance calculateDistances(
+    const PositionVector& reference,
+    const RototranslationMatrixView& matrix,
+    Dist distFunc = manhattanDistance,
+    bool sort = true,
+    ThreadPool* pool = nullptr)
+{
+    auto result = buildDistanceRows<tuple<PositionVector, int, double>>(matrix.size(), pool, [&matrix](size_t i) {
+        auto [vec, idx] = matrix[i];
+        return make_tuple(move(vec), idx, 0.0);
+    });
+    scoreRows<0, 2>(reference, result, distFunc, pool);
     auto rmd = RototranslationMatrixDistance(result, matrix.getCenter());
     if (sort) {
         rmd.sortByDistance();
@@ -834,22 +985,22 @@ RototranslationMatrixDistance calculateDistances(
  * @param matrix Input ModalSelectionMatrix
  * @param distFunc Distance function to use
  * @param sort If true, sort results by distance (default: true)
+ * @param pool Pool that builds and scores the rows, nullptr (default) runs on the calling thread
  * @return ModalSelectionMatrixDistance with computed distances
  */
+template<typename Dist = DistanceFuncRefPV>
 ModalSelectionMatrixDistance<PositionVector> calculateDistances(
     const PositionVector& reference,
     const ModalSelectionMatrix<PositionVector>& matrix,
-    DistanceFuncPV distFunc = manhattanDistance,
-    bool sort = true)
+    Dist distFunc = manhattanDistance,
+    bool sort = true,
+    ThreadPool* pool = nullptr)
 {
-    vector<tuple<PositionVector, int, double>> result;
-    result.reserve(matrix.size());
-    
-    for (size_t i = 0; i < matrix.size(); ++i) {
+    auto result = buildDistanceRows<tuple<PositionVector, int, double>>(matrix.size(), pool, [&matrix](size_t i) {
         const auto& [vec, idx] = matrix[i];
-        double dist = distFunc(reference, vec);
-        result.emplace_back(make_tuple(vec, idx, dist));
-    }
+        return make_tuple(vec, idx, 0.0);
+    });
+    scoreRows<0, 2>(reference, result, distFunc, pool);
     
     auto mmd = ModalSelectionMatrixDistance<PositionVector>(result);
     if (sort) {
@@ -864,22 +1015,22 @@ ModalSelectionMatrixDistance<PositionVector> calculateDistances(
  * @param matrix Input ModalSelectionMatrix
  * @param distFunc Distance function to use
  * @param sort If true, sort results by distance (default: true)
+ * @param pool Pool that builds and scores the rows, nullptr (default) runs on the calling thread
  * @return ModalSelectionMatrixDistance with computed distances
  */
+template<typename Dist = DistanceFuncRefIV>
 ModalSelectionMatrixDistance<IntervalVector> calculateDistances(
     const IntervalVector& reference,
     const ModalSelectionMatrix<IntervalVector>& matrix,
-    DistanceFuncIV distFunc = manhattanDistance,
-    bool sort = true)
+    Dist distFunc = manhattanDistance,
+    bool sort = true,
+    ThreadPool* pool = nullptr)
 {
-    vector<tuple<IntervalVector, int, double>> result;
-    result.reserve(matrix.size());
-    
-    for (size_t i = 0; i < matrix.size(); ++i) {
+    auto result = buildDistanceRows<tuple<IntervalVector, int, double>>(matrix.size(), pool, [&matrix](size_t i) {
         const auto& [vec, idx] = matrix[i];
-        double dist = distFunc(reference, vec);
-        result.emplace_back(make_tuple(vec, idx, dist));
-    }
+        return make_tuple(vec, idx, 0.0);
+    });
+    scoreRows<0, 2>(reference, result, distFunc, pool);
     
     auto mmd = ModalSelectionMatrixDistance<IntervalVector>(result);
     if (sort) {
@@ -1026,28 +1177,41 @@ public:
  * @param matrix Input ModalRototranslationMatrix
  * @param distFunc Distance function to use
  * @param sort If true, sort results by distance (default: true)
+ * @param pool Pool that builds and scores the rows, nullptr (default) runs on the calling thread
  * @return ModalRototranslationMatrixDistance with computed distances
  * @details Computes the distance from the reference to every rototranslated vector
  *          in every mode, storing mode index, translation index, vector, and distance.
  */
+template<typename Dist = DistanceFuncRefPV>
 ModalRototranslationMatrixDistance calculateDistances(
     const PositionVector& reference,
     const ModalRototranslationMatrix<PositionVector>& matrix,
-    DistanceFuncPV distFunc = manhattanDistance,
-    bool sort = true)
+    Dist distFunc = manhattanDistance,
+    bool sort = true,
+    ThreadPool* pool = nullptr)
 {
-    vector<tuple<int, int, PositionVector, double>> result;
-    result.reserve(matrix.getTotalVectorCount());
-    
+    // Row offset of every mode, so modes can be filled independently
+    vector<size_t> first(matrix.size() + 1, 0);
     for (size_t i = 0; i < matrix.size(); ++i) {
-        const auto& [rtm, mode_idx] = matrix[i];
-        
-        for (size_t j = 0; j < rtm.size(); ++j) {
-            const auto& [vec, trans_idx] = rtm[j];
-            double dist = distFunc(reference, vec);
-            result.emplace_back(make_tuple(mode_idx, trans_idx, vec, dist));
+        first[i + 1] = first[i] + matrix[i].first.size();
+    }
+    vector<tuple<int, int, PositionVector, double>> result(first.back());
+    auto fillModes = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const auto& [rtm, mode_idx] = matrix[i];
+            
+            for (size_t j = 0; j < rtm.size(); ++j) {
+                const auto& [vec, trans_idx] = rtm[j];
+                result[first[i] + j] = make_tuple(mode_idx, trans_idx, vec, 0.0);
+            }
         }
+    };
+    if (pool == nullptr) {
+        fillModes(0, matrix.size());
+    } else {
+        pool->parallelFor(matrix.size(), 1, fillModes);
     }
+    scoreRows<2, 3>(reference, result, distFunc, pool);
     
     auto mrmd = ModalRototranslationMatrixDistance(result);
     if (sort) {
@@ -1056,6 +1220,506 @@ ModalRototranslationMatrixDistance calculateDistances(
     return mrmd;
 }
 
+// ==================== RANK SELECTION ====================
+
+/**
+ * @brief Rank selected by a complexity factor
+ * @param complexity Complexity factor (0-100), where 0 = closest, 100 = farthest
+ * @param n Number of rows
+ * @return Rank in [0, n), the index getByComplexity reads after sortByDistance
+ * @throws runtime_error if n is 0 or complexity is out of range
+ */
+inline size_t complexityRank(int complexity, size_t n) {
+    if (n == 0) {
+        throw runtime_error("Cannot get by complexity from empty matrix");
+    }
+    if (complexity < 0 || complexity > 100) {
+        throw runtime_error("Complexity must be between 0 and 100");
+    }
+    return static_cast<size_t>((complexity / 100.0) * (n - 1));
+}
+
+/**
+ * @brief Finds the row with a given rank by distance, sorting only on ties
+ * @param distances Distance of every row, in generation order
+ * @param order Buffer of one index per row, overwritten
+ * @param rank Rank in [0, distances.size())
+ * @return Index of the row that sortByDistance would place at rank
+ * @details Average linear time (nth_element) when the selected distance is unique.
+ *          When other rows share it, the row at rank depends on how sort() orders
+ *          ties; that order only depends on the comparisons made, so the indices are
+ *          sorted with the comparison of sortByDistance to pick the same row.
+ */
+template<typename Distances, typename Order>
+size_t nthByDistance(const Distances& distances, Order& order, size_t rank) {
+    using Index = typename Order::value_type;
+    auto closer = [&distances](Index a, Index b) {
+        return distances[a] < distances[b];
+    };
+    iota(order.begin(), order.end(), Index(0));
+    nth_element(order.begin(), order.begin() + rank, order.end(), closer);
+    Index selected = order[rank];
+    if (count(distances.begin(), distances.end(), distances[selected]) == 1) {
+        return selected;
+    }
+    iota(order.begin(), order.end(), Index(0));
+    sort(order.begin(), order.end(), closer);
+    return order[rank];
+}
+
+/**
+ * @brief Finds the row with a given rank by distance, sorting only on ties
+ * @see nthByDistance(const Distances&, Order&, size_t)
+ */
+inline size_t nthByDistance(const vector<double>& distances, size_t rank) {
+    vector<size_t> order(distances.size());
+    return nthByDistance(distances, order, rank);
+}
+
+/**
+ * @brief Streaming reducer keeping the k rows closest to a reference
+ * @tparam Entry Stored row type (e.g. tuple<PositionVector, int, double>)
+ *
+ * @details Rows are offered one at a time together with their distance. The reducer
+ *          holds at most k of them in a bounded max-heap, and a row that cannot be
+ *          among the k closest is rejected before it is built, so the memory used
+ *          does not depend on the number of rows scanned. Equal distances favour
+ *          the row offered first, so take() returns the first k rows of a stable
+ *          sort by distance.
+ *
+ * @code
+ * TopKDistanceReducer<tuple<PositionVector, int, double>> reducer(3);
+ * for (size_t i = 0; i < view.size(); ++i) {
+ *     auto [vec, idx] = view[i];
+ *     double dist = manhattanDistance(reference, vec);
+ *     reducer.offer(dist, [&]() { return make_tuple(vec, idx, dist); });
+ * }
+ * auto closest = reducer.take();
+ * @endcode
+ */
+template<typename Entry>
+class TopKDistanceReducer {
+private:
+    struct Slot {
+        double distance;
+        size_t order;   ///< Position in the offered sequence, breaks ties
+        Entry entry;
+    };
+
+    vector<Slot> heap_;     // Max-heap on (distance, order)
+    size_t capacity_;
+    size_t offered_;
+
+    static bool before(const Slot& a, const Slot& b) {
+        if (a.distance != b.distance) {
+            return a.distance < b.distance;
+        }
+        return a.order < b.order;
+    }
+
+public:
+    /**
+     * @brief Creates an empty reducer
+     * @param k Maximum number of rows kept
+     * @param expectedRows Number of rows that will be offered, if known, to size the heap once
+     */
+    explicit TopKDistanceReducer(size_t k, size_t expectedRows = 0)
+        : capacity_(k), offered_(0) {
+        heap_.reserve(min(k, expectedRows));
+    }
+
+    size_t size() const { return heap_.size(); }
+    size_t capacity() const { return capacity_; }
+    bool empty() const { return heap_.empty(); }
+
+    /**
+     * @brief Number of rows offered so far, kept or not
+     */
+    size_t offered() const { return offered_; }
+
+    /**
+     * @brief Whether a row at the given distance would be kept if offered now
+     */
+    bool accepts(double distance) const {
+        if (heap_.size() < capacity_) return true;
+        // A new row is offered after every stored one, so it must be strictly closer
+        return !heap_.empty() && distance < heap_.front().distance;
+    }
+
+    /**
+     * @brief Offers a row, building it only if it is kept
+     * @param distance Distance of the row
+     * @param makeEntry Callable returning the Entry, invoked only on acceptance
+     * @return True if the row was kept
+     */
+    template<typename MakeEntry>
+    bool offer(double distance, MakeEntry&& makeEntry) {
+        size_t order = offered_++;
+        if (!accepts(distance)) {
+            return false;
+        }
+        if (heap_.size() == capacity_) {
+            pop_heap(heap_.begin(), heap_.end(), before);
+            heap_.pop_back();
+        }
+        heap_.push_back(Slot{distance, order, makeEntry()});
+        push_heap(heap_.begin(), heap_.end(), before);
+        return true;
+    }
+
+    /**
+     * @brief Offers an already built row
+     * @return True if the row was kept
+     */
+    bool push(double distance, const Entry& entry) {
+        return offer(distance, [&entry]() { return entry; });
+    }
+
+    /**
+     * @brief Extracts the kept rows sorted by distance and empties the reducer
+     * @return At most k rows, closest first
+     */
+    vector<Entry> take() {
+        sort_heap(heap_.begin(), heap_.end(), before);
+        vector<Entry> result;
+        result.reserve(heap_.size());
+        for (auto& slot : heap_) {
+            result.push_back(move(slot.entry));
+        }
+        heap_.clear();
+        offered_ = 0;
+        return result;
+    }
+};
+
+/**
+ * @brief Distances from a reference to every row of a matrix or lazy view
+ * @return Distances in row order
+ */
+template<typename Ref, typename Matrix, typename DistFunc>
+vector<double> rowDistances(const Ref& reference, const Matrix& matrix, DistFunc distFunc) {
+    vector<double> distances;
+    distances.reserve(matrix.size());
+    for (size_t i = 0; i < matrix.size(); ++i) {
+        distances.push_back(evaluateDistance(distFunc, reference, matrix[i].first));
+    }
+    return distances;
+}
+
+/**
+ * @brief Row of a matrix or lazy view selected by complexity
+ * @return (row index, distance) of the row getByComplexity would return
+ */
+template<typename Ref, typename Matrix, typename DistFunc>
+pair<size_t, double> rowByComplexity(const Ref& reference, const Matrix& matrix,
+                                     int complexity, DistFunc distFunc) {
+    vector<double> distances = rowDistances(reference, matrix, distFunc);
+    size_t index = nthByDistance(distances, complexityRank(complexity, distances.size()));
+    return {index, distances[index]};
+}
+
+/**
+ * @brief The k rows of a matrix or lazy view closest to a reference
+ * @return Rows as (vector, index, distance), closest first
+ */
+template<typename Ref, typename Matrix, typename DistFunc>
+auto closestRows(const Ref& reference, const Matrix& matrix, size_t k, DistFunc distFunc) {
+    using Vec = decay_t<decltype(matrix[0].first)>;
+    TopKDistanceReducer<tuple<Vec, int, double>> reducer(k, matrix.size());
+    for (size_t i = 0; i < matrix.size(); ++i) {
+        const auto& row = matrix[i];
+        double dist = evaluateDistance(distFunc, reference, row.first);
+        reducer.offer(dist, [&]() { return make_tuple(row.first, row.second, dist); });
+    }
+    return reducer.take();
+}
+
+/**
+ * @brief Selects one row of a ModalMatrix by complexity without sorting the rows
+ * @param reference Reference vector to compare against
+ * @param matrix Input ModalMatrix
+ * @param complexity Complexity factor (0-100), where 0 = closest, 100 = farthest
+ * @param distFunc Distance function to use
+ * @return Same row as calculateDistances(reference, matrix, distFunc).getByComplexity(complexity)
+ * @throws runtime_error if matrix is empty or complexity is out of range
+ * @details Only distances are stored during the scan and only the selected row is copied.
+ */
+template<typename T, typename Dist = DistanceFuncRef<T>>
+ModalMatrixRow<T> selectByComplexity(
+    const T& reference,
+    const ModalMatrix<T>& matrix,
+    int complexity = 0,
+    Dist distFunc = manhattanDistance)
+{
+    auto [index, dist] = rowByComplexity(reference, matrix, complexity, distFunc);
+    const auto& [vec, idx] = matrix[index];
+    return ModalMatrixRow<T>(vec, idx, dist);
+}
+
+/**
+ * @brief Selects one row of a lazy modal matrix by complexity without sorting the rows
+ * @details The selected row is the only one computed twice; no row is stored.
+ * @see selectByComplexity(const T&, const ModalMatrix<T>&, int, Dist)
+ */
+template<typename T, typename Dist = DistanceFuncRef<T>>
+ModalMatrixRow<T> selectByComplexity(
+    const T& reference,
+    const ModalMatrixView<T>& matrix,
+    int complexity = 0,
+    Dist distFunc = manhattanDistance)
+{
+    auto [index, dist] = rowByComplexity(reference, matrix, complexity, distFunc);
+    auto [vec, idx] = matrix[index];
+    return ModalMatrixRow<T>(vec, idx, dist);
+}
+
+/**
+ * @brief Selects one row of a TranspositionMatrix by complexity without sorting the rows
+ * @see selectByComplexity(const T&, const ModalMatrix<T>&, int, Dist)
+ */
+template<typename Dist = DistanceFuncRefPV>
+TranspositionMatrixRow selectByComplexity(
+    const PositionVector& reference,
+    const TranspositionMatrix& matrix,
+    int complexity = 0,
+    Dist distFunc = manhattanDistance)
+{
+    auto [index, dist] = rowByComplexity(reference, matrix, complexity, distFunc);
+    const auto& [vec, idx] = matrix[index];
+    return TranspositionMatrixRow(vec, idx, dist);
+}
+
+/**
+ * @brief Selects one row of a lazy transposition matrix by complexity without sorting the rows
+ * @see selectByComplexity(const T&, const ModalMatrix<T>&, int, Dist)
+ */
+template<typename Dist = DistanceFuncRefPV>
+TranspositionMatrixRow selectByComplexity(
+    const PositionVector& reference,
+    const TranspositionMatrixView& matrix,
+    int complexity = 0,
+    Dist distFunc = manhattanDistance)
+{
+    auto [index, dist] = rowByComplexity(reference, matrix, complexity, distFunc);
+    auto [vec, idx] = matrix[index];
+    return TranspositionMatrixRow(vec, idx, dist);
+}
+
+/**
+ * @brief Selects one row of a RototranslationMatrix by complexity without sorting the rows
+ * @see selectByComplexity(const T&, const ModalMatrix<T>&, int, Dist)
+ */
+template<typename Dist = DistanceFuncRefPV>
+RototranslationMatrixRow selectByComplexity(
+    const PositionVector& reference,
+    const RototranslationMatrix& matrix,
+    int complexity = 0,
+    Dist distFunc = manhattanDistance)
+{
+    auto [index, dist] = rowByComplexity(reference, matrix, complexity, distFunc);
+    const auto& [vec, idx] = matrix[index];
+    return RototranslationMatrixRow(vec, idx, dist, matrix.getCenter());
+}
+
+/**
+ * @brief Selects one row of a lazy rototranslation matrix by complexity without sorting the rows
+ * @see selectByComplexity(const T&, const ModalMatrix<T>&, int, Dist)
+ */
+template<typename Dist = DistanceFuncRefPV>
+RototranslationMatrixRow selectByComplexity(
+    const PositionVector& reference,
+    const RototranslationMatrixView& matrix,
+    int complexity = 0,
+    Dist distFunc = manhattanDistance)
+{
+    auto [index, dist] = rowByComplexity(reference, matrix, complexity, distFunc);
+    auto [vec, idx] = matrix[index];
+    return RototranslationMatrixRow(vec, idx, dist, matrix.getCenter());
+}
+
+/**
+ * @brief Selects one row of a ModalSelectionMatrix by complexity without sorting the rows
+ * @see selectByComplexity(const T&, const ModalMatrix<T>&, int, Dist)
+ */
+template<typename T, typename Dist = DistanceFuncRef<T>>
+ModalSelectionMatrixRow<T> selectByComplexity(
+    const T& reference,
+    const ModalSelectionMatrix<T>& matrix,
+    int complexity = 0,
+    Dist distFunc = manhattanDistance)
+{
+    auto [index, dist] = rowByComplexity(reference, matrix, complexity, distFunc);
+    const auto& [chord, mode] = matrix[index];
+    return ModalSelectionMatrixRow<T>(chord, mode, dist);
+}
+
+/**
+ * @brief Selects one vector of a modal rototranslation matrix by complexity without sorting the rows
+ * @param reference Reference PositionVector to compare against
+ * @param matrix Input ModalRototranslationMatrix
+ * @param complexity Complexity factor (0-100), where 0 = closest, 100 = farthest
+ * @param distFunc Distance function to use
+ * @return Same row as calculateDistances(reference, matrix, distFunc).getByComplexity(complexity)
+ * @throws runtime_error if matrix is empty or complexity is out of range
+ */
+template<typename Dist = DistanceFuncRefPV>
+ModalRototranslationMatrixRow selectByComplexity(
+    const PositionVector& reference,
+    const ModalRototranslationMatrix<PositionVector>& matrix,
+    int complexity = 0,
+    Dist distFunc = manhattanDistance)
+{
+    vector<double> distances;
+    distances.reserve(matrix.getTotalVectorCount());
+    for (size_t i = 0; i < matrix.size(); ++i) {
+        const RototranslationMatrix& rtm = matrix[i].first;
+        for (size_t j = 0; j < rtm.size(); ++j) {
+            distances.push_back(evaluateDistance(distFunc, reference, rtm[j].first));
+        }
+    }
+    
+    size_t flat = nthByDistance(distances, complexityRank(complexity, distances.size()));
+    
+    // Walk back from the flat index to (mode, translation)
+    size_t i = 0;
+    size_t j = flat;
+    while (j >= matrix[i].first.size()) {
+        j -= matrix[i].first.size();
+        ++i;
+    }
+    const auto& [rtm, mode_idx] = matrix[i];
+    const auto& [vec, trans_idx] = rtm[j];
+    return ModalRototranslationMatrixRow(mode_idx, trans_idx, vec, distances[flat]);
+}
+
+/**
+ * @brief Keeps only the k rows of a ModalMatrix closest to a reference
+ * @param reference Reference vector to compare against
+ * @param matrix Input ModalMatrix
+ * @param k Maximum number of rows returned
+ * @param distFunc Distance function to use
+ * @return ModalMatrixDistance holding the k smallest distances of calculateDistances, closest first
+ * @details Uses a TopKDistanceReducer: O(n log k) time and O(k) rows stored. Rows at equal
+ *          distance are kept in generation order, which sortByDistance does not guarantee.
+ */
+template<typename T, typename Dist = DistanceFuncRef<T>>
+ModalMatrixDistance<T> calculateClosestDistances(
+    const T& reference,
+    const ModalMatrix<T>& matrix,
+    size_t k,
+    Dist distFunc = manhattanDistance)
+{
+    return ModalMatrixDistance<T>(closestRows(reference, matrix, k, distFunc));
+}
+
+/**
+ * @brief Keeps only the k rows of a lazy modal matrix closest to a reference
+ * @see calculateClosestDistances(const T&, const ModalMatrix<T>&, size_t, Dist)
+ */
+template<typename T, typename Dist = DistanceFuncRef<T>>
+ModalMatrixDistance<T> calculateClosestDistances(
+    const T& reference,
+    const ModalMatrixView<T>& matrix,
+    size_t k,
+    Dist distFunc = manhattanDistance)
+{
+    return ModalMatrixDistance<T>(closestRows(reference, matrix, k, distFunc));
+}
+
+/**
+ * @brief Keeps only the k rows of a TranspositionMatrix closest to a reference
+ * @see calculateClosestDistances(const T&, const ModalMatrix<T>&, size_t, Dist)
+ */
+template<typename Dist = DistanceFuncRefPV>
+TranspositionMatrixDistance calculateClosestDistances(
+    const PositionVector& reference,
+    const TranspositionMatrix& matrix,
+    size_t k,
+    Dist distFunc = manhattanDistance)
+{
+    return TranspositionMatrixDistance(closestRows(reference, matrix, k, distFunc));
+}
+
+/**
+ * @brief Keeps only the k rows of a lazy transposition matrix closest to a reference
+ * @see calculateClosestDistances(const T&, const ModalMatrix<T>&, size_t, Dist)
+ */
+template<typename Dist = DistanceFuncRefPV>
+TranspositionMatrixDistance calculateClosestDistances(
+    const PositionVector& reference,
+    const TranspositionMatrixView& matrix,
+    size_t k,
+    Dist distFunc = manhattanDistance)
+{
+    return TranspositionMatrixDistance(closestRows(reference, matrix, k, distFunc));
+}
+
+/**
+ * @brief Keeps only the k rows of a RototranslationMatrix closest to a reference
+ * @see calculateClosestDistances(const T&, const ModalMatrix<T>&, size_t, Dist)
+ */
+template<typename Dist = DistanceFuncRefPV>
+RototranslationMatrixDistance calculateClosestDistances(
+    const PositionVector& reference,
+    const RototranslationMatrix& matrix,
+    size_t k,
+    Dist distFunc = manhattanDistance)
+{
+    return RototranslationMatrixDistance(closestRows(reference, matrix, k, distFunc), matrix.getCenter());
+}
+
+/**
+ * @brief Keeps only the k rows of a lazy rototranslation matrix closest to a reference
+ * @see calculateClosestDistances(const T&, const ModalMatrix<T>&, size_t, Dist)
+ */
+template<typename Dist = DistanceFuncRefPV>
+RototranslationMatrixDistance calculateClosestDistances(
+    const PositionVector& reference,
+    const RototranslationMatrixView& matrix,
+    size_t k,
+    Dist distFunc = manhattanDistance)
+{
+    return RototranslationMatrixDistance(closestRows(reference, matrix, k, distFunc), matrix.getCenter());
+}
+
+/**
+ * @brief Keeps only the k rows of a ModalSelectionMatrix closest to a reference
+ * @see calculateClosestDistances(const T&, const ModalMatrix<T>&, size_t, Dist)
+ */
+template<typename T, typename Dist = DistanceFuncRef<T>>
+ModalSelectionMatrixDistance<T> calculateClosestDistances(
+    const T& reference,
+    const ModalSelectionMatrix<T>& matrix,
+    size_t k,
+    Dist distFunc = manhattanDistance)
+{
+    return ModalSelectionMatrixDistance<T>(closestRows(reference, matrix, k, distFunc));
+}
+
+/**
+ * @brief Keeps only the k vectors of a modal rototranslation matrix closest to a reference
+ * @see calculateClosestDistances(const T&, const ModalMatrix<T>&, size_t, Dist)
+ */
+template<typename Dist = DistanceFuncRefPV>
+ModalRototranslationMatrixDistance calculateClosestDistances(
+    const PositionVector& reference,
+    const ModalRototranslationMatrix<PositionVector>& matrix,
+    size_t k,
+    Dist distFunc = manhattanDistance)
+{
+    TopKDistanceReducer<tuple<int, int, PositionVector, double>> reducer(k, matrix.getTotalVectorCount());
+    for (size_t i = 0; i < matrix.size(); ++i) {
+        const auto& [rtm, mode_idx] = matrix[i];
+        int mode = mode_idx;
+        for (size_t j = 0; j < rtm.size(); ++j) {
+            const pair<PositionVector, int>& row = rtm[j];
+            double dist = evaluateDistance(distFunc, reference, row.first);
+            reducer.offer(dist, [&]() { return make_tuple(mode, row.second, row.first, dist); });
+        }
+    }
+    return ModalRototranslationMatrixDistance(reducer.take());
+}
+
 // ==================== PRINT HELPERS ====================
 
 // Helper to stringify a PositionVector or IntervalVector's data
@@ -2,6 +2,7 @@
 #define MEASURES_H
 
 #include "./vectors.h"
+#include "./setClass.h"
 #include "./Vector.h"
 
 /**
@@ -407,6 +408,27 @@ double calculateSpectrumVariation(vector<int>& widths, int numberOfTones) {
     return static_cast<double>(sumOfWidths) / numberOfTones;
 }
 
+/**
+ * @brief Check whether a scale holds distinct pitch classes in ascending order
+ *
+ * For such scales the sort-and-compare tests below reduce to bitmask operations.
+ *
+ * @param scale Input PositionVector
+ * @return true if the data are strictly increasing in [0, mod) and mod is at most 64
+ */
+bool isSortedPitchClassSet(const PositionVector& scale) {
+    if (scale.mod < 1 || scale.mod > PitchClassMask::MAX_MOD) {
+        return false;
+    }
+    for (size_t i = 0; i < scale.data.size(); ++i) {
+        if (scale.data[i] < 0 || scale.data[i] >= scale.mod ||
+            (i > 0 && scale.data[i - 1] >= scale.data[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
 /**
  * @brief Find rotational symmetry axes for a scale
  *
@@ -418,6 +440,12 @@ double calculateSpectrumVariation(vector<int>& widths, int numberOfTones) {
 vector<int> findRotationalSymmetryAxes(PositionVector& scale) {
     vector<int> normalizedScale = scale.data;
 
+    // A sorted set of distinct pitch classes compares equal to its sorted transposition
+    // exactly when the transposition maps the set onto itself, which is a word rotation
+    if (isSortedPitchClassSet(scale)) {
+        return PitchClassMask(scale.data, scale.mod).transpositionalSymmetries();
+    }
+
     vector<int> axes;
     int n = normalizedScale.size();
     for (int interval = 1; interval < scale.mod; ++interval) {
@@ -527,6 +555,11 @@ bool isPalindrome(PositionVector& scale) {
  * @return true if the scale is chiral (not superposable with its mirror)
  */
 bool isChiral(PositionVector& scale) {
+    // The mirror is a transposition of the set exactly when both share the Tn prime form
+    if (isSortedPitchClassSet(scale)) {
+        return classifySet(scale).chiral;
+    }
+
     vector<int> normalizedScale = scale.data;
 
     vector<int> mirroredScale = normalizedScale;
@@ -748,7 +781,7 @@ void printAnalysis(PositionVector p) {
     cout << endl << endl;
 
     cout << "Onsets:" << endl;
-    for (int i : onsets.data) {
+    for (int i : onsets.getData()) {
         cout << i << " ";
     }
     cout << endl << endl;
@@ -1,7 +1,9 @@
 #ifndef NOTENAMES_H
 #define NOTENAMES_H
 
-#include "PositionVector.h"
+#include "./positionVector.h"
+#include <array>
+#include <string_view>
 
 /**
  * @file NoteNaming.h
@@ -59,6 +61,40 @@ struct NoteMapperOptions {
         : preferSharps(sharps), isDiatonicScale(diatonic), moduloValue(modulo) {}
 };
 
+/**
+ * @brief Enharmonic spellings of each pitch class
+ * @details Groups of three are (natural, sharp side, flat side), groups of two are
+ *          (sharp, flat); unused slots are empty. The literals have static storage, so
+ *          views of them never dangle.
+ */
+inline constexpr string_view NOTE_SPELLINGS[12][3] = {
+    {"C", "B♯", "D♭♭"},
+    {"C♯", "D♭", ""},
+    {"D", "C♯♯", "E♭♭"},
+    {"D♯", "E♭", ""},
+    {"E", "D♯♯", "F♭"},
+    {"F", "E♯", "G♭♭"},
+    {"F♯", "G♭", ""},
+    {"G", "F♯♯", "A♭♭"},
+    {"G♯", "A♭", ""},
+    {"A", "G♯♯", "B♭♭"},
+    {"A♯", "B♭", ""},
+    {"B", "A♯♯", "C♭"}
+};
+
+/**
+ * @struct NoteSpellingBatch
+ * @brief Spellings of many note sets in one flat buffer
+ */
+struct NoteSpellingBatch {
+    vector<string_view> names;  ///< Spellings of all sets, concatenated
+    vector<size_t> offsets;     ///< Set i spans [offsets[i], offsets[i + 1]) in names
+
+    size_t size() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+    const string_view* begin(size_t i) const { return names.data() + offsets[i]; }
+    const string_view* end(size_t i) const { return names.data() + offsets[i + 1]; }
+};
+
 /**
  * @class NoteNamingSystem
  * @brief Complete system for converting MIDI numbers to note names
@@ -66,26 +102,97 @@ struct NoteMapperOptions {
 class NoteNamingSystem {
 private:
     /// Enharmonically equivalent notes
-    vector<vector<string>> noteArrays = {
-        {"C", "B♯", "D♭♭"},
-        {"C♯", "D♭"},
-        {"D", "C♯♯", "E♭♭"},
-        {"D♯", "E♭"},
-        {"E", "D♯♯", "F♭"},
-        {"F", "E♯", "G♭♭"},
-        {"F♯", "G♭"},
-        {"G", "F♯♯", "A♭♭"},
-        {"G♯", "A♭"},
-        {"A", "G♯♯", "B♭♭"},
-        {"A♯", "B♭"},
-        {"B", "A♯♯", "C♭"}
-    };
+    vector<vector<string>> noteArrays = buildNoteArrays();
     
     /// Classified notes with their alteration directions
     vector<vector<ClassifiedNote>> classifiedNotes;
     
     /// Note order for consecutive checking
     const vector<char> noteOrder = {'A', 'B', 'C', 'D', 'E', 'F', 'G'};
+
+    /**
+     * @brief Cached diatonic spelling of one ordered 7-note sequence
+     */
+    struct DiatonicSpelling {
+        bool found;                   ///< False if no consecutive spelling exists
+        array<string_view, 7> names;  ///< Spelling of each note, in input order
+    };
+
+    /// Diatonic spellings keyed by the packed note indices and the sharps preference
+    unordered_map<uint32_t, DiatonicSpelling> diatonicCache;
+
+    static vector<vector<string>> buildNoteArrays() {
+        vector<vector<string>> arrays;
+        for (const auto& group : NOTE_SPELLINGS) {
+            vector<string> names;
+            for (string_view name : group) {
+                if (!name.empty()) names.emplace_back(name);
+            }
+            arrays.push_back(names);
+        }
+        return arrays;
+    }
+
+    /**
+     * @brief Spelling of one note outside diatonic mode
+     * @details Natural name if any, otherwise the sharp or flat name by preference
+     */
+    static string_view standardSpelling(int noteIndex, bool preferSharps) {
+        const auto& group = NOTE_SPELLINGS[noteIndex];
+        bool hasNatural = !group[2].empty();
+        return (hasNatural || preferSharps) ? group[0] : group[1];
+    }
+
+    /**
+     * @brief Best consecutive spelling of a 7-note sequence, without allocation
+     * @details Tries the 7 starting letters, rejects double accidentals and keeps the first
+     *          configuration with the highest score: +10 per accidental in the preferred
+     *          direction, -10 per accidental against it, +5 per natural.
+     * @return False if no starting letter gives a valid spelling
+     */
+    bool searchConsecutiveSpelling(const int noteIndices[7], bool preferSharps,
+                                   array<string_view, 7>& out) const {
+        int bestScore = INT_MIN;
+        for (size_t startIdx = 0; startIdx < 7; ++startIdx) {
+            array<string_view, 7> candidate;
+            bool isValid = true;
+            int score = 0;
+            for (size_t i = 0; i < 7 && isValid; ++i) {
+                char requiredLetter = noteOrder[(startIdx + i) % 7];
+                isValid = false;
+                for (string_view note : NOTE_SPELLINGS[noteIndices[i]]) {
+                    if (!note.empty() && note[0] == requiredLetter) {
+                        isValid = note.find("♯♯") == string_view::npos &&
+                                  note.find("♭♭") == string_view::npos;
+                        candidate[i] = note;
+                        break;
+                    }
+                }
+                if (!isValid) break;
+                if (candidate[i].find("♯") != string_view::npos) {
+                    score += preferSharps ? 10 : -10;
+                } else if (candidate[i].find("♭") != string_view::npos) {
+                    score += preferSharps ? -10 : 10;
+                } else {
+                    score += 5;
+                }
+            }
+            if (isValid && score > bestScore) {
+                bestScore = score;
+                out = candidate;
+            }
+        }
+        return bestScore != INT_MIN;
+    }
+
+    /**
+     * @brief Pitch-class index of a MIDI number, rounded to the nearest semitone
+     */
+    static int noteIndexOf(int midi, int moduloValue) {
+        pair<int, double> parts = processMidiNumber(midi, moduloValue);
+        int noteValue = parts.first + (parts.second > 0.5 ? 1 : 0);
+        return ((noteValue % 12) + 12) % 12;
+    }
     
     /**
      * @brief Classifies notes based on alteration direction
@@ -120,79 +227,6 @@ private:
         return noteName.empty() ? '\0' : noteName[0];
     }
     
-    /**
-     * @brief Gets next consecutive note letter
-     */
-    char getNextNoteLetter(char currentNote) const {
-        auto it = find(noteOrder.begin(), noteOrder.end(), currentNote);
-        if (it == noteOrder.end()) return '\0';
-        
-        size_t index = distance(noteOrder.begin(), it);
-        return noteOrder[(index + 1) % 7];
-    }
-    
-    /**
-     * @brief Checks if notes form consecutive sequence
-     */
-    bool areNotesConsecutive(const vector<string>& noteNames) const {
-        if (noteNames.empty()) return true;
-        
-        vector<char> basicNotes;
-        for (const auto& name : noteNames) {
-            basicNotes.push_back(getBasicNoteName(name));
-        }
-        
-        // Check all possible starting positions
-        for (size_t start = 0; start < noteOrder.size(); ++start) {
-            bool isValid = true;
-            
-            for (size_t i = 0; i < basicNotes.size(); ++i) {
-                size_t expected = (start + i) % noteOrder.size();
-                if (basicNotes[i] != noteOrder[expected]) {
-                    isValid = false;
-                    break;
-                }
-            }
-            
-            if (isValid) return true;
-        }
-        
-        return false;
-    }
-    
-    /**
-     * @brief Checks if a configuration contains double sharps or double flats
-     */
-    bool hasDoubleAccidentals(const vector<string>& noteNames) const {
-        for (const auto& note : noteNames) {
-            if (note.find("♯♯") != string::npos || note.find("##") != string::npos ||
-                note.find("♭♭") != string::npos || note.find("bb") != string::npos) {
-                return true;
-            }
-        }
-        return false;
-    }
-    
-    /**
-     * @brief Scores a note configuration based on preference
-     * Higher score = better match to preference
-     */
-    int scoreConfiguration(const vector<string>& noteNames, bool preferSharps) const {
-        int score = 0;
-        
-        for (const auto& note : noteNames) {
-            if (note.find("♯") != string::npos || note.find("#") != string::npos) {
-                score += preferSharps ? 10 : -10;
-            } else if (note.find("♭") != string::npos || note.find("b") != string::npos) {
-                score += preferSharps ? -10 : 10;
-            } else {
-                score += 5; // Natural notes are neutral but slightly preferred
-            }
-        }
-        
-        return score;
-    }
-    
     /**
      * @brief Finds all possible consecutive note configurations
      * Returns the best configuration according to preferSharps
@@ -205,63 +239,11 @@ private:
             return {}; // Only works for 7-note scales
         }
         
-        vector<vector<string>> validConfigurations;
-        
-        // Try all 7 possible starting letters for consecutive sequences
-        for (size_t startIdx = 0; startIdx < 7; ++startIdx) {
-            vector<string> candidate;
-            bool isValid = true;
-            
-            // For each position in the scale
-            for (size_t i = 0; i < 7; ++i) {
-                char requiredLetter = noteOrder[(startIdx + i) % 7];
-                int noteIndex = noteIndices[i];
-                
-                // Find an enharmonic equivalent with this letter
-                const auto& possibleNotes = noteArrays[noteIndex];
-                string foundNote = "";
-                
-                for (const auto& note : possibleNotes) {
-                    if (getBasicNoteName(note) == requiredLetter) {
-                        foundNote = note;
-                        break;
-                    }
-                }
-                
-                if (foundNote.empty()) {
-                    isValid = false;
-                    break;
-                }
-                
-                candidate.push_back(foundNote);
-            }
-            
-            if (isValid && areNotesConsecutive(candidate)) {
-                // For diatonic scales, filter out configurations with double accidentals
-                if (!hasDoubleAccidentals(candidate)) {
-                    validConfigurations.push_back(candidate);
-                }
-            }
-        }
-        
-        // If no valid configurations found, return empty
-        if (validConfigurations.empty()) {
+        array<string_view, 7> best;
+        if (!searchConsecutiveSpelling(noteIndices.data(), preferSharps, best)) {
             return {};
         }
-        
-        // Score all valid configurations and return the best one
-        int bestScore = INT_MIN;
-        vector<string> bestConfig;
-        
-        for (const auto& config : validConfigurations) {
-            int score = scoreConfiguration(config, preferSharps);
-            if (score > bestScore) {
-                bestScore = score;
-                bestConfig = config;
-            }
-        }
-        
-        return bestConfig;
+        return vector<string>(best.begin(), best.end());
     }
     
     /**
@@ -286,6 +268,29 @@ private:
         return "";
     }
     
+    /**
+     * @brief Processes one MIDI number with modulo and rounding
+     * @return Integer part and decimal part (rounded to 2 decimal places)
+     */
+    static pair<int, double> processMidiNumber(int midi, int moduloValue) {
+        // Calculate modulo-adjusted value
+        double adjusted = static_cast<double>(midi);
+        if (moduloValue > 0 && moduloValue != 12) {
+            int modResult = ((midi % moduloValue) + moduloValue) % moduloValue;
+            adjusted = modResult * (12.0 / moduloValue);
+        }
+        
+        // Round to 2 decimal places
+        adjusted = round(adjusted * 100.0) / 100.0;
+        
+        // Separate integer and decimal parts
+        int intPart = static_cast<int>(floor(adjusted));
+        double decPart = adjusted - intPart;
+        decPart = round(decPart * 100.0) / 100.0;
+        
+        return {intPart, decPart};
+    }
+
     /**
      * @brief Processes MIDI numbers with modulo and rounding
      */
@@ -294,24 +299,10 @@ private:
         int moduloValue) const {
         
         vector<pair<int, double>> processed;
+        processed.reserve(midiNumbers.size());
         
         for (int midi : midiNumbers) {
-            // Calculate modulo-adjusted value
-            double adjusted = static_cast<double>(midi);
-            if (moduloValue > 0 && moduloValue != 12) {
-                int modResult = ((midi % moduloValue) + moduloValue) % moduloValue;
-                adjusted = modResult * (12.0 / moduloValue);
-            }
-            
-            // Round to 2 decimal places
-            adjusted = round(adjusted * 100.0) / 100.0;
-            
-            // Separate integer and decimal parts
-            int intPart = static_cast<int>(floor(adjusted));
-            double decPart = adjusted - intPart;
-            decPart = round(decPart * 100.0) / 100.0;
-            
-            processed.emplace_back(intPart, decPart);
+            processed.push_back(processMidiNumber(midi, moduloValue));
         }
         
         return processed;
@@ -442,6 +433,85 @@ public:
         return midiNumbersToNoteNames(pv.getData(), options);
     }
     
+    // ==================== SPELLING CACHE ====================
+
+    /**
+     * @brief Spells MIDI numbers as interned note names
+     * @details Same names as midiNumbersToNoteNames, without cents information. Names are
+     *          views of NOTE_SPELLINGS, so nothing is allocated per note. Diatonic
+     *          spellings are memoized by ordered pitch-class sequence and sharps
+     *          preference, so a repeated scale costs one hash lookup.
+     * @param midiNumbers MIDI note numbers
+     * @param options Configuration options
+     * @param out Receives the names, appended in input order
+     * @note The cache makes this method non-const: do not share one system across threads
+     */
+    void spellInto(const vector<int>& midiNumbers, const NoteMapperOptions& options,
+                   vector<string_view>& out) {
+        size_t n = midiNumbers.size();
+        if (options.isDiatonicScale && n == 7) {
+            int noteIndices[7];
+            uint32_t key = options.preferSharps ? 1u << 28 : 0u;
+            for (size_t i = 0; i < 7; ++i) {
+                noteIndices[i] = noteIndexOf(midiNumbers[i], options.moduloValue);
+                key |= static_cast<uint32_t>(noteIndices[i]) << (4 * i);
+            }
+            auto it = diatonicCache.find(key);
+            if (it == diatonicCache.end()) {
+                DiatonicSpelling spelling;
+                spelling.found = searchConsecutiveSpelling(noteIndices, options.preferSharps, spelling.names);
+                it = diatonicCache.emplace(key, spelling).first;
+            }
+            if (it->second.found) {
+                out.insert(out.end(), it->second.names.begin(), it->second.names.end());
+                return;
+            }
+        }
+        for (int midi : midiNumbers) {
+            out.push_back(standardSpelling(noteIndexOf(midi, options.moduloValue), options.preferSharps));
+        }
+    }
+
+    /**
+     * @brief Spells MIDI numbers as interned note names
+     * @see spellInto
+     */
+    vector<string_view> spell(const vector<int>& midiNumbers, const NoteMapperOptions& options) {
+        vector<string_view> names;
+        names.reserve(midiNumbers.size());
+        spellInto(midiNumbers, options, names);
+        return names;
+    }
+
+    /**
+     * @brief Spells many note sets with the same options
+     * @param sets MIDI note numbers of each set
+     * @param options Configuration options
+     * @return All spellings in one buffer, indexed by set
+     */
+    NoteSpellingBatch spellBatch(const vector<vector<int>>& sets, const NoteMapperOptions& options) {
+        NoteSpellingBatch batch;
+        size_t total = 0;
+        for (const auto& set : sets) {
+            total += set.size();
+        }
+        batch.names.reserve(total);
+        batch.offsets.reserve(sets.size() + 1);
+        batch.offsets.push_back(0);
+        for (const auto& set : sets) {
+            spellInto(set, options, batch.names);
+            batch.offsets.push_back(batch.names.size());
+        }
+        return batch;
+    }
+
+    /**
+     * @brief Number of memoized diatonic sequences
+     */
+    size_t cachedSpellings() const { return diatonicCache.size(); }
+
+    void clearSpellingCache() { diatonicCache.clear(); }
+
     /**
      * @brief Prints test results for multiple test cases
      */
@@ -0,0 +1,277 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include "./utility.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+/**
+ * @file parallel.h
+ * @brief Work-stealing thread pool for the batch algorithms
+ * @author [not251]
+ * @date 2025
+ * @details parallelFor splits an index range into chunks and spreads them over per-thread
+ *          queues. A thread takes chunks from the back of its own queue and, once it is
+ *          empty, steals from the front of the others, so uneven chunks (a long chord, a
+ *          large mode) do not leave threads idle. The calling thread works on its own
+ *          loop too, and a parallelFor started inside a chunk runs on the same pool.
+ *
+ *          Results are written by index, so every parallel algorithm returns exactly what
+ *          its serial version returns, whatever the thread count or the scheduling.
+ *
+ *          The parallel algorithms read their inputs from several threads at once.
+ *          PositionVector, IntervalVector, BinaryVector and Vectors allow that. A
+ *          user-supplied distance callable must not write shared state.
+ */
+
+/**
+ * @class ThreadPool
+ * @brief Fixed set of worker threads with one work-stealing queue each
+ */
+class ThreadPool {
+private:
+    struct Queue {
+        mutex lock;
+        deque<function<void()>> tasks;
+    };
+
+    vector<unique_ptr<Queue>> queues_;   // one per worker, the last one shared by outside threads
+    vector<thread> workers_;
+    mutex sleepLock_;
+    condition_variable wake_;
+    atomic<size_t> queued_{0};
+    atomic<size_t> next_{0};
+    bool stop_ = false;
+
+    struct WorkerSlot {
+        const ThreadPool* pool = nullptr;
+        size_t index = 0;
+    };
+
+    static WorkerSlot& currentWorker() {
+        thread_local WorkerSlot slot;
+        return slot;
+    }
+
+    // Queue of the running thread: its own for a worker of this pool, the shared last one otherwise
+    size_t ownQueue() const {
+        const WorkerSlot& slot = currentWorker();
+        return slot.pool == this ? slot.index : queues_.size() - 1;
+    }
+
+    // queued_ is raised before the task is visible, so it never reads lower than the queued tasks
+    void push(function<void()> task) {
+        const WorkerSlot& worker = currentWorker();
+        size_t slot = worker.pool == this ? worker.index : next_.fetch_add(1, memory_order_relaxed) % queues_.size();
+        queued_.fetch_add(1, memory_order_release);
+        lock_guard<mutex> guard(queues_[slot]->lock);
+        queues_[slot]->tasks.push_back(move(task));
+    }
+
+    bool popOwn(size_t slot, function<void()>& task) {
+        Queue& queue = *queues_[slot];
+        lock_guard<mutex> guard(queue.lock);
+        if (queue.tasks.empty()) {
+            return false;
+        }
+        task = move(queue.tasks.back());
+        queue.tasks.pop_back();
+        return true;
+    }
+
+    bool steal(size_t slot, function<void()>& task) {
+        Queue& queue = *queues_[slot];
+        lock_guard<mutex> guard(queue.lock);
+        if (queue.tasks.empty()) {
+            return false;
+        }
+        task = move(queue.tasks.front());
+        queue.tasks.pop_front();
+        return true;
+    }
+
+    /**
+     * @brief Runs one queued task, own queue first
+     * @return False if every queue was empty
+     */
+    bool runOne() {
+        if (queued_.load(memory_order_acquire) == 0) {
+            return false;
+        }
+        function<void()> task;
+        size_t start = ownQueue();
+        bool found = popOwn(start, task);
+        for (size_t k = 1; !found && k < queues_.size(); ++k) {
+            found = steal((start + k) % queues_.size(), task);
+        }
+        if (!found) {
+            return false;
+        }
+        queued_.fetch_sub(1, memory_order_relaxed);
+        task();
+        return true;
+    }
+
+    void workerLoop(size_t index) {
+        currentWorker() = WorkerSlot{this, index};
+        while (true) {
+            if (runOne()) {
+                continue;
+            }
+            unique_lock<mutex> guard(sleepLock_);
+            wake_.wait(guard, [this] { return stop_ || queued_.load(memory_order_acquire) > 0; });
+            if (stop_ && queued_.load(memory_order_acquire) == 0) {
+                return;
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief Starts the pool
+     * @param threads Threads working on a parallelFor, the calling one included;
+     *                0 uses std::thread::hardware_concurrency(). 1 runs everything inline.
+     */
+    explicit ThreadPool(size_t threads = 0) {
+        if (threads == 0) {
+            threads = max(1u, thread::hardware_concurrency());
+        }
+        for (size_t i = 0; i < threads; ++i) {
+            queues_.push_back(make_unique<Queue>());
+        }
+        workers_.reserve(threads - 1);
+        for (size_t i = 0; i + 1 < threads; ++i) {
+            workers_.emplace_back([this, i] { workerLoop(i); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool() {
+        {
+            lock_guard<mutex> guard(sleepLock_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (thread& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    /**
+     * @brief Threads working on a parallelFor, the calling one included
+     */
+    size_t size() const { return queues_.size(); }
+
+    /**
+     * @brief Calls body(begin, end) on chunks covering [0, count) and waits for all of them
+     * @param count Number of indices
+     * @param grain Minimum chunk size; ranges up to one grain run inline on the calling thread
+     * @param body Callable taking (size_t begin, size_t end); chunks run concurrently,
+     *             so it must only write state owned by its indices
+     * @details The range is cut into about four chunks per thread, never smaller than
+     *          grain. If chunks throw, the first exception is rethrown once all chunks
+     *          have finished.
+     */
+    template<typename Body>
+    void parallelFor(size_t count, size_t grain, Body body) {
+        grain = max<size_t>(grain, 1);
+        if (count == 0) {
+            return;
+        }
+        if (workers_.empty() || count <= grain) {
+            body(size_t(0), count);
+            return;
+        }
+        size_t chunk = max(grain, (count + 4 * size() - 1) / (4 * size()));
+        size_t chunks = (count + chunk - 1) / chunk;
+
+        size_t remaining = chunks;
+        mutex doneLock;
+        condition_variable done;
+        exception_ptr error;
+        mutex errorLock;
+
+        auto runChunk = [&](size_t c) {
+            try {
+                body(c * chunk, min(count, (c + 1) * chunk));
+            } catch (...) {
+                lock_guard<mutex> guard(errorLock);
+                if (!error) {
+                    error = current_exception();
+                }
+            }
+            lock_guard<mutex> guard(doneLock);
+            if (--remaining == 0) {
+                done.notify_all();
+            }
+        };
+
+        // Chunk 0 stays with the calling thread, the others are offered to the pool
+        for (size_t c = chunks; c-- > 1;) {
+            push([&runChunk, c] { runChunk(c); });
+        }
+        {
+            lock_guard<mutex> guard(sleepLock_);
+        }
+        wake_.notify_all();
+        runChunk(0);
+
+        // Help with queued work until every chunk is taken, then wait for the running ones.
+        // remaining is only read under doneLock, so the locals outlive the last chunk.
+        while (true) {
+            {
+                lock_guard<mutex> guard(doneLock);
+                if (remaining == 0) {
+                    break;
+                }
+            }
+            if (!runOne()) {
+                unique_lock<mutex> guard(doneLock);
+                if (done.wait_for(guard, chrono::microseconds(200), [&remaining] { return remaining == 0; })) {
+                    break;
+                }
+            }
+        }
+        if (error) {
+            rethrow_exception(error);
+        }
+    }
+
+    /**
+     * @brief Fills out[i] = fn(i) for i in [0, count)
+     * @param count Number of results
+     * @param fn Callable taking size_t, returning the result for that index
+     * @param grain Minimum chunk size, default 1
+     * @return Results in index order
+     * @details The result type must be default constructible.
+     */
+    template<typename Fn>
+    auto parallelMap(size_t count, Fn fn, size_t grain = 1) -> vector<decltype(fn(size_t(0)))> {
+        vector<decltype(fn(size_t(0)))> out(count);
+        parallelFor(count, grain, [&out, &fn](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                out[i] = fn(i);
+            }
+        });
+        return out;
+    }
+};
+
+/**
+ * @brief Shared pool with one thread per hardware thread
+ * @details Created on first use. Pass a ThreadPool of your own to choose the thread count.
+ */
+inline ThreadPool& defaultThreadPool() {
+    static ThreadPool pool;
+    return pool;
+}
+
+#endif // PARALLEL_H
@@ -0,0 +1,221 @@
+#ifndef PITCHCLASSMASK_H
+#define PITCHCLASSMASK_H
+
+#include "./mathUtil.h"
+#include "./bitUtil.h"
+#include "./smallVector.h"
+
+/**
+ * @file pitchClassMask.h
+ * @brief Pitch-class set stored as a single 64-bit word
+ * @author [not251]
+ * @date 2025
+ * @details For moduli up to 64 a pitch-class set fits in one machine word: pitch
+ *          class i is bit i. Transposition becomes a word rotation, inversion a bit
+ *          reversal, and complement, subset and membership tests are single logical
+ *          operations. Conversions from and to PositionVector and BinaryVector are
+ *          in vectors.h.
+ */
+
+/**
+ * @class PitchClassMask
+ * @brief Set of pitch classes modulo mod (1 to 64) packed in a 64-bit word
+ */
+class PitchClassMask {
+public:
+    static constexpr int MAX_MOD = static_cast<int>(WORD_BITS); ///< Largest supported modulus
+
+private:
+    uint64_t bits_; ///< Bit i set if pitch class i belongs to the set
+    int mod_;       ///< Modulus (number of pitch classes)
+
+    static void validateMod(int mod) {
+        if (mod < 1 || mod > MAX_MOD) {
+            throw invalid_argument("PitchClassMask modulus must be between 1 and 64");
+        }
+    }
+
+    uint64_t full() const { return lowMask64(static_cast<size_t>(mod_)); }
+
+public:
+    // ==================== CONSTRUCTORS ====================
+
+    /**
+     * @brief Creates an empty set
+     * @param mod Modulus, default 12
+     * @throw invalid_argument If mod is outside [1, 64]
+     */
+    explicit PitchClassMask(int mod = 12) : bits_(0), mod_(mod) {
+        validateMod(mod);
+    }
+
+    /**
+     * @brief Creates the set of pitch classes of the given values
+     * @param values Any integers, reduced with Euclidean modulo
+     * @param mod Modulus, default 12
+     * @throw invalid_argument If mod is outside [1, 64]
+     */
+    PitchClassMask(const VectorData& values, int mod = 12) : PitchClassMask(mod) {
+        for (int value : values) {
+            insert(value);
+        }
+    }
+
+    /**
+     * @brief Creates a set from a raw word
+     * @param bits Bit i set for pitch class i (bits at or above mod are ignored)
+     * @param mod Modulus
+     * @return New PitchClassMask
+     */
+    static PitchClassMask fromBits(uint64_t bits, int mod) {
+        PitchClassMask result(mod);
+        result.bits_ = bits & result.full();
+        return result;
+    }
+
+    // ==================== GETTERS ====================
+
+    uint64_t getBits() const { return bits_; }
+    int getMod() const { return mod_; }
+
+    /**
+     * @brief Number of pitch classes in the set
+     */
+    int size() const { return popcount64(bits_); }
+    bool empty() const { return bits_ == 0; }
+
+    /**
+     * @brief Membership test
+     * @param value Any integer, reduced with Euclidean modulo
+     */
+    bool contains(int value) const {
+        return (bits_ >> euclideanDivision(value, mod_).remainder) & 1ULL;
+    }
+
+    /**
+     * @brief Pitch classes in ascending order
+     * @return Values in [0, mod)
+     */
+    VectorData toData() const {
+        VectorData out;
+        out.reserve(static_cast<size_t>(size()));
+        for (uint64_t w = bits_; w != 0; w &= w - 1) {
+            out.push_back(ctz64(w));
+        }
+        return out;
+    }
+
+    // ==================== MODIFIERS ====================
+
+    void insert(int value) { bits_ |= 1ULL << euclideanDivision(value, mod_).remainder; }
+    void erase(int value) { bits_ &= ~(1ULL << euclideanDivision(value, mod_).remainder); }
+
+    // ==================== TRANSFORMATIONS ====================
+
+    /**
+     * @brief Transposition by a word rotation
+     * @param interval Any integer
+     * @return Set with every pitch class p mapped to (p + interval) mod mod
+     */
+    PitchClassMask transpose(int interval) const {
+        size_t shift = static_cast<size_t>(euclideanDivision(interval, mod_).remainder);
+        return fromBits(rotateBitsLeft(bits_, shift, static_cast<size_t>(mod_)), mod_);
+    }
+
+    /**
+     * @brief Inversion by a bit reversal
+     * @param axis Sum of each pitch class and its image, default 0
+     * @return Set with every pitch class p mapped to (axis - p) mod mod
+     */
+    PitchClassMask invert(int axis = 0) const {
+        // Reversing the low mod bits maps p to mod - 1 - p, the rotation adds axis + 1
+        uint64_t reversed = reverseBits64(bits_) >> (WORD_BITS - static_cast<size_t>(mod_));
+        return fromBits(reversed, mod_).transpose(axis + 1);
+    }
+
+    /**
+     * @brief Pitch classes not in the set
+     */
+    PitchClassMask complement() const { return fromBits(~bits_, mod_); }
+
+    /**
+     * @brief Transposition-invariant representative of the set
+     * @return The transposition of this set with the smallest bit pattern, equal for
+     *         any two sets that are transpositions of each other
+     */
+    PitchClassMask transpositionClass() const {
+        uint64_t best = bits_;
+        for (int k = 1; k < mod_; ++k) {
+            best = min(best, rotateBitsLeft(bits_, static_cast<size_t>(k), static_cast<size_t>(mod_)));
+        }
+        return fromBits(best, mod_);
+    }
+
+    // ==================== SET RELATIONS ====================
+
+    bool isSubsetOf(const PitchClassMask& other) const { return (bits_ & ~other.bits_) == 0; }
+    bool isSupersetOf(const PitchClassMask& other) const { return other.isSubsetOf(*this); }
+    bool intersects(const PitchClassMask& other) const { return (bits_ & other.bits_) != 0; }
+
+    /**
+     * @brief Intervals that map the set onto itself
+     * @return Values k in [1, mod) with transpose(k) equal to this set
+     */
+    vector<int> transpositionalSymmetries() const {
+        vector<int> result;
+        for (int k = 1; k < mod_; ++k) {
+            if (transpose(k).bits_ == bits_) {
+                result.push_back(k);
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Interval-class vector
+     * @return Entry k-1 counts the unordered pairs of pitch classes at interval class k,
+     *         for k in [1, mod/2]
+     */
+    vector<int> intervalClassVector() const {
+        int classes = mod_ / 2;
+        vector<int> icv(static_cast<size_t>(classes), 0);
+        for (int k = 1; k <= classes; ++k) {
+            int count = popcount64(bits_ & transpose(k).bits_);
+            // At k = mod/2 each pair is counted once from each of its ends
+            icv[k - 1] = (2 * k == mod_) ? count / 2 : count;
+        }
+        return icv;
+    }
+
+    // ==================== OPERATORS ====================
+
+    PitchClassMask operator|(const PitchClassMask& other) const { return fromBits(bits_ | other.bits_, mod_); }
+    PitchClassMask operator&(const PitchClassMask& other) const { return fromBits(bits_ & other.bits_, mod_); }
+    PitchClassMask operator^(const PitchClassMask& other) const { return fromBits(bits_ ^ other.bits_, mod_); }
+    PitchClassMask operator~() const { return complement(); }
+
+    bool operator==(const PitchClassMask& other) const {
+        return bits_ == other.bits_ && mod_ == other.mod_;
+    }
+
+    bool operator!=(const PitchClassMask& other) const {
+        return !(*this == other);
+    }
+
+    /**
+     * @brief Output stream operator
+     * @details Format: {pc1, pc2, ...} (mod: m)
+     */
+    friend ostream& operator<<(ostream& os, const PitchClassMask& mask) {
+        VectorData pcs = mask.toData();
+        os << "{";
+        for (size_t i = 0; i < pcs.size(); ++i) {
+            os << pcs[i];
+            if (i < pcs.size() - 1) os << ", ";
+        }
+        os << "} (mod: " << mask.mod_ << ")";
+        return os;
+    }
+};
+
+#endif // PITCHCLASSMASK_H
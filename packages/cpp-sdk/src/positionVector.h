@@ -2,6 +2,9 @@
 #define POSITIONVECTOR_H
 
 #include "./mathUtil.h"
+#include "./smallVector.h"
+#include "./vectorExpression.h"
+#include "./pitchClassMask.h"
 
 /**
  * @file PositionVector.h
@@ -29,12 +32,19 @@
  */
 class PositionVector {
 public:
-    vector<int> data;        ///< Vector data
+    VectorData data;        ///< Vector data
     int mod;                 ///< Base modulus (cyclic period)
     int userRange;           ///< User-defined range
     int range;               ///< Effective range used in calculations
     bool rangeUpdate;        ///< Flag for automatic range updating
     bool user;               ///< Flag to use userRange instead of mod
+
+    /// Scalar operation node, used by lazy() chains and the componentwise methods
+    template<typename Op>
+    using ScalarExpression = ScalarExpr<VectorLeaf<PositionVector>, Op>;
+    /// Component-wise operation node, used by lazy() chains and the componentwise methods
+    template<typename Op>
+    using ComponentwiseExpression = ComponentwiseExpr<VectorLeaf<PositionVector>, Op>;
 private:
     /**
      * @brief Calculates the range needed to contain all values
@@ -128,7 +138,7 @@ public:
      * 
      * @note If userRange is 0 or negative, it's automatically set equal to mod
      */
-    PositionVector(const vector<int>& data, 
+    PositionVector(const VectorData& data, 
                    int mod = 12, 
                    int userRange = 0,
                    bool rangeUpdate = true, 
@@ -143,8 +153,35 @@ public:
         range = initializeRange();
     }
 
+    /**
+     * @brief Evaluates an arithmetic expression
+     * 
+     * @param expr Expression built from PositionVector operators
+     * 
+     * @details All elements are computed in a single pass and the range is
+     *          calculated once. Properties are taken from the leftmost operand.
+     */
+    template<typename Expr,
+             typename = enable_if_t<IsVectorExpression<Expr, PositionVector>::value>>
+    PositionVector(const Expr& expr)
+        : PositionVector(expr.evaluate(),
+                         expr.source().mod,
+                         expr.source().userRange,
+                         expr.source().rangeUpdate,
+                         expr.source().user) {}
+
+    /**
+     * @brief Wraps this vector as the leaf of an arithmetic expression
+     */
+    VectorLeaf<PositionVector> leaf() const {
+        return VectorLeaf<PositionVector>(*this);
+    }
+
     // ==================== SCALAR OPERATORS ====================
 
+    // Arithmetic operators return new vectors. To run a chain such as
+    // (v + 3) * 2 % 12 in a single pass, start it with lazy(v), see vectorExpression.h.
+
     /**
      * @brief Adds a scalar to all elements
      * 
@@ -152,11 +189,7 @@ public:
      * @return New PositionVector with the added values
      */
     PositionVector operator+(int scalar) const {
-        vector<int> result(data.size());
-        for (size_t i = 0; i < data.size(); ++i) {
-            result[i] = data[i] + scalar;
-        }
-        return PositionVector(result, mod, userRange, rangeUpdate, user);
+        return leaf() + scalar;
     }
 
     /**
@@ -166,11 +199,7 @@ public:
      * @return New PositionVector with the subtracted values
      */
     PositionVector operator-(int scalar) const {
-        vector<int> result(data.size());
-        for (size_t i = 0; i < data.size(); ++i) {
-            result[i] = data[i] - scalar;
-        }
-        return PositionVector(result, mod, userRange, rangeUpdate, user);
+        return leaf() - scalar;
     }
 
     /**
@@ -180,11 +209,7 @@ public:
      * @return New PositionVector with the multiplied values
      */
     PositionVector operator*(int scalar) const {
-        vector<int> result(data.size());
-        for (size_t i = 0; i < data.size(); ++i) {
-            result[i] = data[i] * scalar;
-        }
-        return PositionVector(result, mod, userRange, rangeUpdate, user);
+        return leaf() * scalar;
     }
 
     /**
@@ -197,16 +222,7 @@ public:
      * @note Uses Euclidean division to guarantee consistent results
      */
     PositionVector operator/(int divisor) const {
-        if (divisor == 0) {
-            throw invalid_argument("Division by zero");
-        }
-        
-        vector<int> result(data.size());
-        for (size_t i = 0; i < data.size(); ++i) {
-            DivisionResult div = euclideanDivision(data[i], divisor);
-            result[i] = div.quotient;
-        }
-        return PositionVector(result, mod, userRange, rangeUpdate, user);
+        return leaf() / divisor;
     }
 
     /**
@@ -217,16 +233,7 @@ public:
      * @throw invalid_argument If divisor is 0
      */
     PositionVector operator%(int divisor) const {
-        if (divisor == 0) {
-            throw invalid_argument("Division by zero");
-        }
-        
-        vector<int> result(data.size());
-        for (size_t i = 0; i < data.size(); ++i) {
-            DivisionResult div = euclideanDivision(data[i], divisor);
-            result[i] = div.remainder;
-        }
-        return PositionVector(result, mod, userRange, rangeUpdate, user);
+        return leaf() % divisor;
     }
 
     // ==================== VECTOR OPERATORS ====================
@@ -240,7 +247,7 @@ public:
      * @note Uses componentwiseSum without looping
      */
     PositionVector operator+(const PositionVector& other) const {
-        return componentwiseSum(other.data, false);
+        return leaf() + other;
     }
 
     /**
@@ -252,7 +259,7 @@ public:
      * @note Uses componentwiseSubtraction without looping
      */
     PositionVector operator-(const PositionVector& other) const {
-        return componentwiseSubtraction(other.data, false);
+        return leaf() - other;
     }
 
     /**
@@ -264,7 +271,7 @@ public:
      * @note Uses componentwiseProduct with looping
      */
     PositionVector operator*(const PositionVector& other) const {
-        return componentwiseProduct(other.data, true);
+        return leaf() * other;
     }
 
     /**
@@ -277,7 +284,7 @@ public:
      * @note Uses componentwiseDivision with looping and Euclidean division
      */
     PositionVector operator/(const PositionVector& other) const {
-        return componentwiseDivision(other.data, true);
+        return leaf() / other;
     }
 
     /**
@@ -290,7 +297,7 @@ public:
      * @note Uses componentwiseModulo with looping and Euclidean division
      */
     PositionVector operator%(const PositionVector& other) const {
-        return componentwiseModulo(other.data, true);
+        return leaf() % other;
     }
 
     // ==================== OPERATORS WITH VECTOR<INT> ====================
@@ -301,8 +308,8 @@ public:
      * @param other Vector to add
      * @return New PositionVector result of the addition
      */
-    PositionVector operator+(const vector<int>& other) const {
-        return componentwiseSum(other, false);
+    PositionVector operator+(const VectorData& other) const {
+        return leaf() + other;
     }
 
     /**
@@ -311,8 +318,8 @@ public:
      * @param other Vector to subtract
      * @return New PositionVector result of the subtraction
      */
-    PositionVector operator-(const vector<int>& other) const {
-        return componentwiseSubtraction(other, false);
+    PositionVector operator-(const VectorData& other) const {
+        return leaf() - other;
     }
 
     /**
@@ -321,8 +328,8 @@ public:
      * @param other Vector to multiply
      * @return New PositionVector result of the product
      */
-    PositionVector operator*(const vector<int>& other) const {
-        return componentwiseProduct(other, true);
+    PositionVector operator*(const VectorData& other) const {
+        return leaf() * other;
     }
 
     /**
@@ -332,8 +339,8 @@ public:
      * @return New PositionVector with the quotients
      * @throw invalid_argument If other contains zeros
      */
-    PositionVector operator/(const vector<int>& other) const {
-        return componentwiseDivision(other, true);
+    PositionVector operator/(const VectorData& other) const {
+        return leaf() / other;
     }
 
     /**
@@ -343,8 +350,8 @@ public:
      * @return New PositionVector with the remainders
      * @throw invalid_argument If other contains zeros
      */
-    PositionVector operator%(const vector<int>& other) const {
-        return componentwiseModulo(other, true);
+    PositionVector operator%(const VectorData& other) const {
+        return leaf() % other;
     }
 
     // ==================== COMPOUND ASSIGNMENT OPERATORS ====================
@@ -494,7 +501,7 @@ public:
      * @param other Vector to add
      * @return Reference to this modified object
      */
-    PositionVector& operator+=(const vector<int>& other) {
+    PositionVector& operator+=(const VectorData& other) {
         *this = *this + other;
         return *this;
     }
@@ -505,7 +512,7 @@ public:
      * @param other Vector to subtract
      * @return Reference to this modified object
      */
-    PositionVector& operator-=(const vector<int>& other) {
+    PositionVector& operator-=(const VectorData& other) {
         *this = *this - other;
         return *this;
     }
@@ -516,7 +523,7 @@ public:
      * @param other Vector to multiply
      * @return Reference to this modified object
      */
-    PositionVector& operator*=(const vector<int>& other) {
+    PositionVector& operator*=(const VectorData& other) {
         *this = *this * other;
         return *this;
     }
@@ -528,7 +535,7 @@ public:
      * @return Reference to this modified object
      * @throw invalid_argument If other contains zeros
      */
-    PositionVector& operator/=(const vector<int>& other) {
+    PositionVector& operator/=(const VectorData& other) {
         *this = *this / other;
         return *this;
     }
@@ -540,7 +547,7 @@ public:
      * @return Reference to this modified object
      * @throw invalid_argument If other contains zeros
      */
-    PositionVector& operator%=(const vector<int>& other) {
+    PositionVector& operator%=(const VectorData& other) {
         *this = *this % other;
         return *this;
     }
@@ -672,7 +679,7 @@ public:
      * @brief Gets the data vector
      * @return Const reference to the integer vector
      */
-    const vector<int>& getData() const { return data; }
+    const VectorData& getData() const { return data; }
 
     /**
      * @brief Gets the base modulus
@@ -810,7 +817,7 @@ public:
         for (const PositionVector& pv : vectors) {
             int scaleFactor = lcm / pv.mod;
             
-            vector<int> scaledData(pv.data.size());
+            VectorData scaledData(pv.data.size());
             for (size_t i = 0; i < pv.data.size(); ++i) {
                 scaledData[i] = pv.data[i] * scaleFactor;
             }
@@ -844,7 +851,7 @@ public:
             return *this;
         }
 
-        vector<int> rotatedData(data.size());
+        VectorData rotatedData(data.size());
         int absRotation = abs(rotationAmount);
         int size = static_cast<int>(data.size());
         
@@ -869,7 +876,7 @@ public:
     PositionVector rotoTranslate(int startOffset, int length = 0) const {
         int outLength = (length == 0) ? static_cast<int>(data.size()) : abs(length);
         
-        vector<int> newData(outLength);
+        VectorData newData(outLength);
         for (int i = 0; i < outLength; i++) {
             newData[i] = (*this)[startOffset + i];
         }
@@ -899,13 +906,22 @@ public:
         }
 
         int minValue = *min_element(data.begin(), data.end());
-        PositionVector normalized = *this - minValue;
-        set<int> normalizedSet(normalized.data.begin(), normalized.data.end());
-        
-        vector<int> complementData;
-        for (int i = 0; i < effectiveRange; ++i) {
-            if (normalizedSet.find(i) == normalizedSet.end()) {
-                complementData.emplace_back(i);
+        VectorData complementData;
+
+        if (effectiveRange <= PitchClassMask::MAX_MOD) {
+            // Values past the range are not part of the universe and are skipped
+            PitchClassMask present(effectiveRange);
+            for (int value : data) {
+                if (value - minValue < effectiveRange) present.insert(value - minValue);
+            }
+            complementData = present.complement().toData();
+        } else {
+            vector<bool> present(effectiveRange, false);
+            for (int value : data) {
+                if (value - minValue < effectiveRange) present[value - minValue] = true;
+            }
+            for (int i = 0; i < effectiveRange; ++i) {
+                if (!present[i]) complementData.emplace_back(i);
             }
         }
 
@@ -929,7 +945,7 @@ public:
             return *this;
         }
 
-        vector<int> invertedData(data.size());
+        VectorData invertedData(data.size());
         int size = static_cast<int>(data.size());
         
         // Normalize the axis index
@@ -1018,39 +1034,11 @@ public:
      *          With useLooping=false: adds up to min(size1, size2),
      *          then appends remaining unmodified elements.
      */
-    PositionVector componentwiseSum(const vector<int>& other, bool useLooping = false) const {
+    PositionVector componentwiseSum(const VectorData& other, bool useLooping = false) const {
         if (other.empty()) return *this;
         if (data.empty()) return PositionVector(other, mod, userRange, rangeUpdate, user);
         
-        vector<int> result;
-        
-        if (useLooping) {
-            size_t maxLength = max(data.size(), other.size());
-            result.reserve(maxLength);
-            
-            for (size_t i = 0; i < maxLength; ++i) {
-                int component1 = data[i % data.size()];
-                int component2 = other[i % other.size()];
-                result.emplace_back(component1 + component2);
-            }
-        } else {
-            size_t minLength = min(data.size(), other.size());
-            result.reserve(max(data.size(), other.size()));
-            
-            for (size_t i = 0; i < minLength; ++i) {
-                result.emplace_back(data[i] + other[i]);
-            }
-            
-            for (size_t i = minLength; i < data.size(); ++i) {
-                result.emplace_back(data[i]);
-            }
-            
-            for (size_t i = minLength; i < other.size(); ++i) {
-                result.emplace_back(other[i]);
-            }
-        }
-        
-        return PositionVector(result, mod, userRange, rangeUpdate, user);
+        return ComponentwiseExpression<ExprAdd>(leaf(), other, useLooping);
     }
 
     /**
@@ -1062,39 +1050,11 @@ public:
      * 
      * @details Behavior analogous to componentwiseSum but with subtraction
      */
-    PositionVector componentwiseSubtraction(const vector<int>& other, bool useLooping = false) const {
+    PositionVector componentwiseSubtraction(const VectorData& other, bool useLooping = false) const {
         if (other.empty()) return *this;
         if (data.empty()) return PositionVector(other, mod, userRange, rangeUpdate, user);
         
-        vector<int> result;
-        
-        if (useLooping) {
-            size_t maxLength = max(data.size(), other.size());
-            result.reserve(maxLength);
-            
-            for (size_t i = 0; i < maxLength; ++i) {
-                int component1 = data[i % data.size()];
-                int component2 = other[i % other.size()];
-                result.emplace_back(component1 - component2);
-            }
-        } else {
-            size_t minLength = min(data.size(), other.size());
-            result.reserve(max(data.size(), other.size()));
-            
-            for (size_t i = 0; i < minLength; ++i) {
-                result.emplace_back(data[i] - other[i]);
-            }
-            
-            for (size_t i = minLength; i < data.size(); ++i) {
-                result.emplace_back(data[i]);
-            }
-            
-            for (size_t i = minLength; i < other.size(); ++i) {
-                result.emplace_back(other[i]);
-            }
-        }
-        
-        return PositionVector(result, mod, userRange, rangeUpdate, user);
+        return ComponentwiseExpression<ExprSubtract>(leaf(), other, useLooping);
     }
 
     /**
@@ -1107,39 +1067,11 @@ public:
      * @note If other is empty, returns an empty vector.
      *       If data is empty, returns itself.
      */
-    PositionVector componentwiseProduct(const vector<int>& other, bool useLooping = true) const {
+    PositionVector componentwiseProduct(const VectorData& other, bool useLooping = true) const {
         if (other.empty()) return PositionVector({}, mod, userRange, rangeUpdate, user);
         if (data.empty()) return *this;
         
-        vector<int> result;
-        
-        if (useLooping) {
-            size_t maxLength = max(data.size(), other.size());
-            result.reserve(maxLength);
-            
-            for (size_t i = 0; i < maxLength; ++i) {
-                int component1 = data[i % data.size()];
-                int component2 = other[i % other.size()];
-                result.emplace_back(component1 * component2);
-            }
-        } else {
-            size_t minLength = min(data.size(), other.size());
-            result.reserve(max(data.size(), other.size()));
-            
-            for (size_t i = 0; i < minLength; ++i) {
-                result.emplace_back(data[i] * other[i]);
-            }
-            
-            for (size_t i = minLength; i < data.size(); ++i) {
-                result.emplace_back(data[i]);
-            }
-            
-            for (size_t i = minLength; i < other.size(); ++i) {
-                result.emplace_back(other[i]);
-            }
-        }
-        
-        return PositionVector(result, mod, userRange, rangeUpdate, user);
+        return ComponentwiseExpression<ExprMultiply>(leaf(), other, useLooping);
     }
 
     /**
@@ -1152,49 +1084,13 @@ public:
      * 
      * @note Uses Euclidean division for consistent results
      */
-    PositionVector componentwiseDivision(const vector<int>& other, bool useLooping = true) const {
+    PositionVector componentwiseDivision(const VectorData& other, bool useLooping = true) const {
         if (other.empty()) {
             throw invalid_argument("Cannot divide by empty vector");
         }
         if (data.empty()) return *this;
         
-        for (int val : other) {
-            if (val == 0) {
-                throw invalid_argument("Division by zero in componentwise division");
-            }
-        }
-        
-        vector<int> result;
-        
-        if (useLooping) {
-            size_t maxLength = max(data.size(), other.size());
-            result.reserve(maxLength);
-            
-            for (size_t i = 0; i < maxLength; ++i) {
-                int dividend = data[i % data.size()];
-                int divisor = other[i % other.size()];
-                DivisionResult div = euclideanDivision(dividend, divisor);
-                result.emplace_back(div.quotient);
-            }
-        } else {
-            size_t minLength = min(data.size(), other.size());
-            result.reserve(max(data.size(), other.size()));
-            
-            for (size_t i = 0; i < minLength; ++i) {
-                DivisionResult div = euclideanDivision(data[i], other[i]);
-                result.emplace_back(div.quotient);
-            }
-            
-            for (size_t i = minLength; i < data.size(); ++i) {
-                result.emplace_back(data[i]);
-            }
-            
-            for (size_t i = minLength; i < other.size(); ++i) {
-                result.emplace_back(other[i]);
-            }
-        }
-        
-        return PositionVector(result, mod, userRange, rangeUpdate, user);
+        return ComponentwiseExpression<ExprDivide>(leaf(), other, useLooping);
     }
 
     /**
@@ -1207,49 +1103,13 @@ public:
      * 
      * @note Uses Euclidean division for consistent results
      */
-    PositionVector componentwiseModulo(const vector<int>& other, bool useLooping = true) const {
+    PositionVector componentwiseModulo(const VectorData& other, bool useLooping = true) const {
         if (other.empty()) {
             throw invalid_argument("Cannot compute modulo with empty vector");
         }
         if (data.empty()) return *this;
         
-        for (int val : other) {
-            if (val == 0) {
-                throw invalid_argument("Division by zero in componentwise modulo");
-            }
-        }
-        
-        vector<int> result;
-        
-        if (useLooping) {
-            size_t maxLength = max(data.size(), other.size());
-            result.reserve(maxLength);
-            
-            for (size_t i = 0; i < maxLength; ++i) {
-                int dividend = data[i % data.size()];
-                int divisor = other[i % other.size()];
-                DivisionResult div = euclideanDivision(dividend, divisor);
-                result.emplace_back(div.remainder);
-            }
-        } else {
-            size_t minLength = min(data.size(), other.size());
-            result.reserve(max(data.size(), other.size()));
-            
-            for (size_t i = 0; i < minLength; ++i) {
-                DivisionResult div = euclideanDivision(data[i], other[i]);
-                result.emplace_back(div.remainder);
-            }
-            
-            for (size_t i = minLength; i < data.size(); ++i) {
-                result.emplace_back(data[i]);
-            }
-            
-            for (size_t i = minLength; i < other.size(); ++i) {
-                result.emplace_back(other[i]);
-            }
-        }
-        
-        return PositionVector(result, mod, userRange, rangeUpdate, user);
+        return ComponentwiseExpression<ExprModulo>(leaf(), other, useLooping);
     }
 
     // ==================== UTILITY METHODS ====================
@@ -1282,7 +1142,7 @@ public:
      *          then all elements of other. Maintains the properties of this vector.
      */
     PositionVector concatenate(const PositionVector& other) const {
-        vector<int> result = data;
+        VectorData result = data;
         result.insert(result.end(), other.data.begin(), other.data.end());
         return PositionVector(result, mod, userRange, rangeUpdate, user);
     }
@@ -1298,7 +1158,7 @@ public:
     PositionVector repeat(int times) const {
         if (times <= 0) return PositionVector({}, mod, userRange, rangeUpdate, user);
         
-        vector<int> result;
+        VectorData result;
         result.reserve(data.size() * times);
         
         for (int t = 0; t < times; ++t) {
@@ -1327,7 +1187,7 @@ public:
             return *this;
         }
         
-        vector<int> resizedData;
+        VectorData resizedData;
         
         if (start <= end) {
             // Ascending range: from start to end inclusive
@@ -1402,4 +1262,22 @@ public:
     }
 };
 
+/**
+ * @brief Starts a fused arithmetic chain on a PositionVector
+ * @return Expression referring to v; v must outlive it
+ * @details `PositionVector r = lazy(v) + 3;` computes the whole chain in one pass when it is
+ *          converted to a PositionVector. See vectorExpression.h.
+ */
+inline VectorLeaf<PositionVector> lazy(const PositionVector& v) {
+    return v.leaf();
+}
+
+/**
+ * @brief Starts a fused arithmetic chain on a temporary PositionVector
+ * @return Expression owning the vector, safe to keep after the full expression
+ */
+inline OwnedVectorLeaf<PositionVector> lazy(PositionVector&& v) {
+    return OwnedVectorLeaf<PositionVector>(move(v));
+}
+
 #endif // POSITIONVECTOR_H
\ No newline at end of file
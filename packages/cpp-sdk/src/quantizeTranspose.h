@@ -1,7 +1,8 @@
 #ifndef QUANTIZE_TRANSPOSE_H
 #define QUANTIZE_TRANSPOSE_H
 
-#include "./PositionVector.h"
+#include "./positionVector.h"
+#include "./vectorView.h"
 
 /**
  * @file quantize_transpose.h
@@ -15,7 +16,7 @@
  * @brief Quantizes a given note to the nearest value in the specified scale
  * 
  * @param note The note to be quantized
- * @param scale Vector representing the scale
+ * @param scale Scale values, read in place (a PositionVector converts to its view)
  * @param left If true, returns the lower neighbor; otherwise, the upper neighbor
  * @return The quantized note
  * 
@@ -25,16 +26,16 @@
  *          - If left=false: returns the upper neighbor
  *          If the note is outside the scale range, returns the boundary value.
  */
-int quantize(int note, const vector<int>& scale, bool left = true) {
+int quantize(int note, const PositionVectorView& scale, bool left = true) {
     int lower = -1;
     int upper = -1;
     
-    for (size_t i = 0; i < scale.size(); ++i) {
-        if (scale[i] <= note) {
-            lower = scale[i];
+    for (int value : scale) {
+        if (value <= note) {
+            lower = value;
         }
-        if (scale[i] >= note) {
-            upper = scale[i];
+        if (value >= note) {
+            upper = value;
             break;
         }
     }
@@ -45,10 +46,236 @@ int quantize(int note, const vector<int>& scale, bool left = true) {
     return left ? lower : upper;
 }
 
+int quantize(int note, const vector<int>& scale, bool left = true) {
+    // The range of the view is not used, so it is not computed
+    return quantize(note, PositionVectorView::fromBuffer(scale.data(), scale.size(), 12, 0, false), left);
+}
+
+/**
+ * @class ScaleQuantizer
+ * @brief Lookup-table quantizer for one scale
+ * 
+ * @details Built once per scale, it stores for every pitch class in [0, mod) the value
+ *          quantize() returns in each direction and the scale degree transpose() uses,
+ *          so quantizing a note is a Euclidean division and a table load. The tables are
+ *          plain arrays indexed by pitch class, which lets the batch overload compile to
+ *          a gather loop.
+ */
+class ScaleQuantizer {
+private:
+    PositionVector scale_;      ///< Source scale
+    int mod_;                   ///< Modulus, size of every table
+    vector<int> leftValue_;     ///< quantize(pc, scale, true)
+    vector<int> rightValue_;    ///< quantize(pc, scale, false)
+    vector<int> degree_;        ///< Index of pc in the scale, else of its left neighbor, or -1
+    vector<int> rightDegree_;   ///< Index of the right neighbor, or -1
+
+    static int indexOf(const VectorData& data, int value) {
+        auto it = find(data.begin(), data.end(), value);
+        return it == data.end() ? -1 : static_cast<int>(distance(data.begin(), it));
+    }
+
+public:
+    /**
+     * @brief Builds the tables for a scale
+     * 
+     * @param scale Scale degrees, normally sorted pitch classes in [0, mod)
+     * @throw invalid_argument If the scale modulus is not positive
+     */
+    explicit ScaleQuantizer(const PositionVector& scale)
+        : scale_(scale), mod_(scale.getMod()) {
+        if (mod_ < 1) {
+            throw invalid_argument("ScaleQuantizer modulus must be positive");
+        }
+        const VectorData& data = scale.getData();
+        vector<int> values(data.begin(), data.end());
+        size_t size = static_cast<size_t>(mod_);
+        leftValue_.resize(size);
+        rightValue_.resize(size);
+        degree_.resize(size);
+        rightDegree_.resize(size);
+        for (int pc = 0; pc < mod_; ++pc) {
+            int left = ::quantize(pc, values, true);
+            int right = ::quantize(pc, values, false);
+            // An empty scale has no neighbors: notes pass through unchanged
+            leftValue_[pc] = values.empty() ? pc : left;
+            rightValue_[pc] = values.empty() ? pc : right;
+            int exact = indexOf(data, pc);
+            degree_[pc] = exact != -1 ? exact : indexOf(data, left);
+            rightDegree_[pc] = indexOf(data, right);
+        }
+    }
+
+    const PositionVector& getScale() const { return scale_; }
+    int getMod() const { return mod_; }
+
+    /**
+     * @brief Scale degree of a pitch class
+     * 
+     * @param pc Pitch class in [0, mod)
+     * @param left Direction used when pc is not in the scale
+     * @return Degree index, or -1 if the neighbor is not a scale value
+     */
+    int degree(int pc, bool left = true) const {
+        return left ? degree_[pc] : rightDegree_[pc];
+    }
+
+    /**
+     * @brief Quantizes a note, keeping its octave
+     * 
+     * @param note Any note
+     * @param left If true, returns the lower neighbor; otherwise, the upper neighbor
+     * @return Octave of the note times mod plus quantize() of its pitch class
+     */
+    int quantize(int note, bool left = true) const {
+        DivisionResult div = euclideanDivision(note, mod_);
+        const vector<int>& table = left ? leftValue_ : rightValue_;
+        return div.quotient * mod_ + table[div.remainder];
+    }
+
+    /**
+     * @brief Quantizes a buffer of notes
+     * 
+     * @param notes Input notes
+     * @param count Number of notes
+     * @param out Output buffer of at least count values (may alias notes)
+     * @param left Quantization direction
+     */
+    void quantize(const int* notes, size_t count, int* out, bool left = true) const {
+        const int* table = (left ? leftValue_ : rightValue_).data();
+        int mod = mod_;
+        for (size_t i = 0; i < count; ++i) {
+            int quotient = notes[i] / mod;
+            int remainder = notes[i] % mod;
+            // Branch-free floor division
+            int negative = remainder < 0;
+            quotient -= negative;
+            remainder += negative * mod;
+            out[i] = quotient * mod + table[remainder];
+        }
+    }
+
+    vector<int> quantize(const vector<int>& notes, bool left = true) const {
+        vector<int> out(notes.size());
+        quantize(notes.data(), notes.size(), out.data(), left);
+        return out;
+    }
+
+    vector<int> quantize(const PositionVectorView& notes, bool left = true) const {
+        vector<int> out(notes.size());
+        quantize(notes.data(), notes.size(), out.data(), left);
+        return out;
+    }
+};
+
+/**
+ * @class ScaleMapper
+ * @brief Streaming scale-to-scale transposition with constant memory
+ * 
+ * @details Precomputes, for every input pitch class, the degree and output pitch class
+ *          (output root included) in both quantization directions. Notes are then
+ *          mapped chunk by chunk into caller buffers. The duplicate-avoidance rule of
+ *          transpose() looks at the previous input note and the previous output note,
+ *          which the mapper keeps between calls, so splitting a stream into chunks does
+ *          not change the result.
+ */
+class ScaleMapper {
+private:
+    int mod_;
+    int inRoot_;
+    vector<int> degree_[2];     ///< Index 0 left, 1 right; -1 if unmapped
+    vector<int> outPC_[2];      ///< Output pitch class plus output root, per direction
+    int lastInput_ = 0;
+    int lastOutput_ = 0;
+    bool hasInput_ = false;
+    bool hasOutput_ = false;
+
+public:
+    /**
+     * @brief Builds the tables from a quantizer of the input scale
+     * 
+     * @param quantizer Quantizer built for the input scale
+     * @param outputScale Output scale; degree d maps to its element d modulo its size
+     * @param inRoot Root note of the input scale
+     * @param outRoot Root note of the output scale
+     * @throw invalid_argument If the output scale is empty
+     */
+    ScaleMapper(const ScaleQuantizer& quantizer, const PositionVector& outputScale,
+                int inRoot = 0, int outRoot = 0)
+        : mod_(quantizer.getMod()), inRoot_(inRoot) {
+        const VectorData& outScale = outputScale.getData();
+        if (outScale.empty()) {
+            throw invalid_argument("Output scale must not be empty");
+        }
+        int length = static_cast<int>(outScale.size());
+        for (int side = 0; side < 2; ++side) {
+            degree_[side].resize(static_cast<size_t>(mod_));
+            outPC_[side].resize(static_cast<size_t>(mod_));
+            for (int pc = 0; pc < mod_; ++pc) {
+                int degree = quantizer.degree(pc, side == 0);
+                degree_[side][pc] = degree;
+                outPC_[side][pc] = degree == -1 ? 0 : outScale[degree % length] + outRoot;
+            }
+        }
+    }
+
+    ScaleMapper(const PositionVector& inputScale, const PositionVector& outputScale,
+                int inRoot = 0, int outRoot = 0)
+        : ScaleMapper(ScaleQuantizer(inputScale), outputScale, inRoot, outRoot) {}
+
+    /**
+     * @brief Maps a chunk of notes
+     * 
+     * @param notes Input notes
+     * @param count Number of input notes
+     * @param outNotes Receives the mapped notes, room for count values
+     * @param outDegrees Receives the input-scale degrees, room for count values, or nullptr
+     * @return Number of notes written; notes whose pitch class has no degree are dropped
+     */
+    size_t process(const int* notes, size_t count, int* outNotes, int* outDegrees = nullptr) {
+        size_t written = 0;
+        for (size_t i = 0; i < count; ++i) {
+            int note = notes[i];
+            DivisionResult div = euclideanDivision(note - inRoot_, mod_);
+            int pc = div.remainder;
+            int octaveOffset = div.quotient * mod_;
+
+            int degree = degree_[0][pc];
+            if (degree != -1) {
+                int outNote = outPC_[0][pc] + octaveOffset;
+                // Avoid repeating the previous output for a different input note
+                if (hasOutput_ && outNote == lastOutput_ && hasInput_ && note != lastInput_ &&
+                    degree_[1][pc] != -1) {
+                    degree = degree_[1][pc];
+                    outNote = outPC_[1][pc] + octaveOffset;
+                }
+                outNotes[written] = outNote;
+                if (outDegrees != nullptr) {
+                    outDegrees[written] = degree;
+                }
+                ++written;
+                lastOutput_ = outNote;
+                hasOutput_ = true;
+            }
+            lastInput_ = note;
+            hasInput_ = true;
+        }
+        return written;
+    }
+
+    /**
+     * @brief Forgets the previous notes, to start an independent stream
+     */
+    void reset() {
+        hasInput_ = false;
+        hasOutput_ = false;
+    }
+};
+
 /**
  * @brief Quantizes and transposes notes from an input scale to an output scale
  * 
- * @param inputScale The input scale represented as a PositionVector
+ * @param quantizer Quantizer built for the input scale
  * @param outputscale The output scale represented as a PositionVector
  * @param inRoot The root note of the input scale (default 0)
  * @param outRoot The root note of the output scale (default 0)
@@ -67,7 +294,7 @@ int quantize(int note, const vector<int>& scale, bool left = true) {
  *          7. Returns both PositionVectors as a pair
  */
 pair<PositionVector, PositionVector> transpose(
-    const PositionVector& inputScale,
+    const ScaleQuantizer& quantizer,
     const PositionVector& outputscale,
     int inRoot,
     int outRoot,
@@ -75,70 +302,15 @@ pair<PositionVector, PositionVector> transpose(
     PositionVector& outDegrees,
     PositionVector& outNotes
 ) {
-    const vector<int>& inScale = inputScale.getData();
-    const vector<int>& outScale = outputscale.getData();
-    int mod = inputScale.getMod();
-    
-    vector<int> degreesData;
-    vector<int> notesData;
-    int length = static_cast<int>(outScale.size());
+    const PositionVector& inputScale = quantizer.getScale();
     
-    for (size_t i = 0; i < notes.size(); ++i) {
-        int note = notes[i];
-        
-        // Calculate pitch class relative to input root
-        int inPC = (note - inRoot) % mod;
-        if (inPC < 0) inPC += mod;
-        
-        // Calculate octave displacement
-        int octave = (note - inRoot) / mod;
-        if (note - inRoot < 0 && (note - inRoot) % mod != 0) {
-            octave--;
-        }
-        
-        bool left = true;
-        
-        // Find the pitch class in the input scale
-        auto it = find(inScale.begin(), inScale.end(), inPC);
-        int index = -1;
-        
-        if (it != inScale.end()) {
-            index = static_cast<int>(distance(inScale.begin(), it));
-        } else {
-            // Quantize to nearest scale degree
-            inPC = quantize(inPC, inScale, left);
-            it = find(inScale.begin(), inScale.end(), inPC);
-            if (it != inScale.end()) {
-                index = static_cast<int>(distance(inScale.begin(), it));
-            }
-        }
-        
-        if (index != -1) {
-            int degree = index;
-            int outPC = outScale[degree % length];
-            int outNote = outPC + outRoot + octave * mod;
-            
-            // Handle duplicate notes by trying opposite quantization direction
-            if (!notesData.empty() && notesData.back() == outNote) {
-                if (i > 0 && notes[i] != notes[i - 1]) {
-                    left = !left;
-                    inPC = (notes[i] - inRoot) % mod;
-                    if (inPC < 0) inPC += mod;
-                    inPC = quantize(inPC, inScale, left);
-                    
-                    it = find(inScale.begin(), inScale.end(), inPC);
-                    if (it != inScale.end()) {
-                        index = static_cast<int>(distance(inScale.begin(), it));
-                        degree = index;
-                        outPC = outScale[degree % length];
-                        outNote = outPC + outRoot + octave * mod;
-                    }
-                }
-            }
-            
-            notesData.push_back(outNote);
-            degreesData.push_back(degree);
-        }
+    vector<int> degreesData(notes.size());
+    vector<int> notesData(notes.size());
+    if (!notes.empty()) {
+        ScaleMapper mapper(quantizer, outputscale, inRoot, outRoot);
+        size_t written = mapper.process(notes.data(), notes.size(), notesData.data(), degreesData.data());
+        degreesData.resize(written);
+        notesData.resize(written);
     }
     
     // Create PositionVectors with the same properties as inputScale
@@ -154,4 +326,23 @@ pair<PositionVector, PositionVector> transpose(
     return make_pair(outDegrees, outNotes);
 }
 
+/**
+ * @brief Quantizes and transposes notes from an input scale to an output scale
+ * 
+ * @details Builds a ScaleQuantizer for inputScale and forwards to the overload above.
+ *          Callers transposing many note buffers with the same input scale should build
+ *          the quantizer once instead.
+ */
+pair<PositionVector, PositionVector> transpose(
+    const PositionVector& inputScale,
+    const PositionVector& outputscale,
+    int inRoot,
+    int outRoot,
+    const vector<int>& notes,
+    PositionVector& outDegrees,
+    PositionVector& outNotes
+) {
+    return transpose(ScaleQuantizer(inputScale), outputscale, inRoot, outRoot, notes, outDegrees, outNotes);
+}
+
 #endif // QUANTIZE_TRANSPOSE_H
\ No newline at end of file
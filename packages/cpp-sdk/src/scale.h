@@ -2,6 +2,7 @@
 #define SCALE_H
 
 #include "selection.h"
+#include "./staticVector.h"
 
 /**
  * @file scale.h
@@ -143,6 +144,15 @@ public:
         applyTransformations();
     }
 
+    // Constructor from a compile-time StaticIntervalVector
+    template<size_t N, int Mod>
+    Scale(const StaticIntervalVector<N, Mod>& generator, const ScaleParams& params = ScaleParams())
+        : generator(generator.toIntervalVector()),
+          isFromPositions(false),
+          params(params) {
+        applyTransformations();
+    }
+
     // Get as PositionVector
     PositionVector toPositions() const {
         return intervalsToPositions(intervals);
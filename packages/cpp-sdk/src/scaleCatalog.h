@@ -0,0 +1,777 @@
+#ifndef SCALE_CATALOG_H
+#define SCALE_CATALOG_H
+
+#include "./pitchClassMask.h"
+#include <initializer_list>
+#include <cstring>
+
+/**
+ * @file scaleCatalog.h
+ * @brief Built-in scale catalog and its packed, read-only binary image
+ * @author [not251]
+ * @date 2025
+ * @details The catalog of 12TET scales (based on the work of Francesco Balena - The Scale
+ *          Omnibus) is a constexpr table of (sheet, pitch-class mask, name) entries, so it
+ *          needs no start-up work and no allocation.
+ *
+ *          PackedScaleCatalog reads a flat image of the same data with its lookup indexes
+ *          precomputed: a string table, the 12-bit masks, and entry indices ordered by
+ *          cardinality, by mask and by transposition class. The image is one array of 32-bit
+ *          words in native byte order. It is never modified, so a single image serves every
+ *          ScaleDatabase and thread, and it can be written to disk and used in place from a
+ *          memory mapping:
+ *
+ *          @code
+ *          writeScaleCatalog("scales.bin", PackedScaleCatalog::builtin());
+ *          // ... later, possibly in another process
+ *          const void* mapped = mmap(nullptr, bytes, PROT_READ, MAP_SHARED, fd, 0);
+ *          PackedScaleCatalog catalog(mapped, bytes);
+ *          ScaleDatabase db(catalog);
+ *          @endcode
+ */
+
+/**
+ * @brief Pitch-class bitmask of a list of intervals in [0, 12)
+ */
+constexpr uint16_t scaleMask(initializer_list<int> intervals) {
+    uint16_t mask = 0;
+    for (int interval : intervals) {
+        mask |= static_cast<uint16_t>(1u << interval);
+    }
+    return mask;
+}
+
+/**
+ * @brief One scale of a catalog
+ */
+struct ScaleCatalogEntry {
+    uint16_t sheet;     ///< Index into the sheet (category) names
+    uint16_t mask;      ///< Bit i set if the scale contains pitch class i
+    const char* name;   ///< Scale name
+};
+
+inline constexpr const char* SCALE_SHEETS[] = {
+    "Major and minor scales",
+    "Symmetrical scales",
+    "European Scales",
+    "Modal Scales",
+    "Pentatonic Scales",
+    "Jazz Scales",
+    "Asian Scales",
+    "Indian Scales",
+    "Miscellaneous scales"
+};
+
+inline constexpr ScaleCatalogEntry SCALE_CATALOG[] = {
+    // Sheet 1: Major and minor scales
+    {0, scaleMask({0, 2, 4, 5, 7, 9, 11}), "Ionian (Major)"},
+    {0, scaleMask({0, 2, 3, 5, 7, 9, 10}), "Dorian"},
+    {0, scaleMask({0, 1, 3, 5, 7, 8, 10}), "Phrygian"},
+    {0, scaleMask({0, 2, 4, 6, 7, 9, 11}), "Lydian"},
+    {0, scaleMask({0, 2, 4, 5, 7, 9, 10}), "Mixolydian"},
+    {0, scaleMask({0, 2, 3, 5, 7, 8, 10}), "Aeolian (Natural Minor)"},
+    {0, scaleMask({0, 1, 3, 5, 6, 8, 10}), "Locrian"},
+    {0, scaleMask({0, 2, 3, 5, 7, 9, 11}), "Melodic Minor"},
+    {0, scaleMask({0, 1, 3, 5, 7, 9, 10}), "Dorian b2"},
+    {0, scaleMask({0, 2, 4, 6, 8, 9, 11}), "Lydian Augmented"},
+    {0, scaleMask({0, 2, 4, 6, 7, 9, 10}), "Lydian Dominant"},
+    {0, scaleMask({0, 2, 4, 5, 7, 8, 10}), "Melodic Major"},
+    {0, scaleMask({0, 2, 3, 5, 6, 8, 10}), "Half Diminished"},
+    {0, scaleMask({0, 1, 3, 4, 6, 8, 10}), "Altered Dominant"},
+    {0, scaleMask({0, 2, 3, 5, 7, 8, 11}), "Harmonic Minor"},
+    {0, scaleMask({0, 1, 3, 5, 6, 9, 10}), "Locrian #6"},
+    {0, scaleMask({0, 2, 4, 5, 8, 9, 11}), "Ionian Augmented"},
+    {0, scaleMask({0, 2, 3, 6, 7, 9, 10}), "Romanian Minor"},
+    {0, scaleMask({0, 1, 4, 5, 7, 8, 10}), "Phrygian Dominant"},
+    {0, scaleMask({0, 3, 4, 6, 7, 9, 11}), "Lydian #2"},
+    {0, scaleMask({0, 1, 3, 4, 6, 8, 9}), "Ultralocrian"},
+
+    // Sheet 2: Symmetrical scales
+    {1, scaleMask({0, 2, 4, 6, 8, 10}), "Whole-Tone"},
+    {1, scaleMask({0, 3, 4, 7, 8, 11}), "Augmented"},
+    {1, scaleMask({0, 1, 4, 5, 8, 9}), "Inverted Augmented"},
+    {1, scaleMask({0, 2, 3, 5, 6, 8, 9, 11}), "Diminished"},
+    {1, scaleMask({0, 1, 3, 4, 6, 7, 9, 10}), "Diminished Half-tone"},
+    {1, scaleMask({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11}), "Chromatic"},
+    {1, scaleMask({0, 1, 4, 6, 7, 10}), "Tritone"},
+    {1, scaleMask({0, 2, 3, 6, 8, 9}), "Raga Neelangi"},
+    {1, scaleMask({0, 1, 3, 6, 7, 9}), "Messiaen 2nd Mode Truncated"},
+    {1, scaleMask({0, 2, 3, 4, 6, 7, 8, 10, 11}), "Messiaen 3rd Mode"},
+    {1, scaleMask({0, 1, 2, 5, 6, 7, 8, 11}), "Messiaen 4th Mode"},
+    {1, scaleMask({0, 3, 4, 5, 6, 9, 10, 11}), "Messiaen 4th Mode Inverse"},
+    {1, scaleMask({0, 1, 5, 6, 7, 11}), "Messiaen 5th Mode"},
+    {1, scaleMask({0, 4, 5, 6, 10, 11}), "Messiaen 5th Mode Inverse"},
+    {1, scaleMask({0, 2, 4, 5, 6, 8, 10, 11}), "Messiaen 6th Mode"},
+    {1, scaleMask({0, 1, 2, 4, 6, 7, 8, 10}), "Messiaen 6th Mode Inverse"},
+    {1, scaleMask({0, 1, 2, 3, 5, 6, 7, 8, 9, 11}), "Messiaen 7th Mode"},
+    {1, scaleMask({0, 2, 3, 4, 5, 6, 8, 9, 10, 11}), "Messiaen 7th Mode Inverse"},
+    {1, scaleMask({0, 1, 3, 4, 5, 7, 8, 9, 11}), "Genus Chromaticum"},
+    {1, scaleMask({0, 1, 2, 6, 7, 8}), "Two-semitone Tritone"},
+    {1, scaleMask({0, 1, 2, 4, 5, 6, 7, 8, 10, 11}), "Symmetrical Decatonic"},
+    {1, scaleMask({0, 1, 3, 5, 6, 7, 9, 11}), "Van Der Host"},
+
+    // Sheet 3: European Scales
+    {2, scaleMask({0, 1, 2, 3, 5, 7, 9, 10}), "Adonai Malakh"},
+    {2, scaleMask({0, 1, 4, 6, 8, 10, 11}), "Enigmatic (asc)"},
+    {2, scaleMask({0, 1, 4, 5, 8, 10, 11}), "Enigmatic (desc)"},
+    {2, scaleMask({0, 1, 3, 6, 8, 10, 11}), "Enigmatic Minor"},
+    {2, scaleMask({0, 1, 4, 5, 6, 8, 10, 11}), "Enigmatic Mixed"},
+    {2, scaleMask({0, 1, 3, 4, 5, 7, 8, 10}), "Flamenco"},
+    {2, scaleMask({0, 2, 3, 6, 7, 8, 10}), "Gypsy"},
+    {2, scaleMask({0, 1, 4, 5, 7, 8, 9}), "Gypsy Hexatonic"},
+    {2, scaleMask({0, 1, 4, 5, 7, 9, 11}), "Gypsy Inverse"},
+    {2, scaleMask({0, 2, 3, 6, 7, 8, 11}), "Gypsy Minor"},
+    {2, scaleMask({0, 1, 5, 6, 8, 9, 10}), "Hijaz Major"},
+    {2, scaleMask({0, 2, 3, 4, 5, 7, 8, 9, 10}), "Houseini"},
+    {2, scaleMask({0, 3, 4, 5, 7, 9, 11}), "Houzam"},
+    {2, scaleMask({0, 3, 4, 6, 7, 9, 10}), "Hungarian Major"},
+    {2, scaleMask({0, 2, 3, 5, 6, 8, 9}), "Hungarian Major Inverse"},
+    {2, scaleMask({0, 1, 2, 3, 6, 7, 8, 11}), "Hungarian Minor b2"},
+    {2, scaleMask({0, 1, 3, 4, 6, 7}), "Istrian"},
+    {2, scaleMask({0, 2, 3, 5, 6, 9, 11}), "Jeths"},
+    {2, scaleMask({0, 2, 3, 5, 6, 7, 8, 9, 10}), "Kiourdi"},
+    {2, scaleMask({0, 1, 3, 4, 6, 8, 9, 11}), "Magen Abot"},
+    {2, scaleMask({0, 1, 3, 4, 5, 7, 8, 10, 11}), "Moorish Phrygian"},
+    {2, scaleMask({0, 1, 3, 5, 7, 9, 11}), "Neapolitan Major"},
+    {2, scaleMask({0, 1, 3, 4, 7, 9, 11}), "Neapolitan Major b4"},
+    {2, scaleMask({0, 1, 3, 5, 6, 9, 11}), "Neapolitan Major b5"},
+    {2, scaleMask({0, 1, 3, 5, 7, 8, 11}), "Neapolitan Minor"},
+    {2, scaleMask({0, 1, 2, 3, 5, 7, 8, 11}), "Harmonic Neapolitan Minor"},
+    {2, scaleMask({0, 1, 3, 6, 7, 8, 10, 11}), "Neseveri"},
+    {2, scaleMask({0, 1, 3, 5, 6, 8, 10, 11}), "Prokofiev"},
+    {2, scaleMask({0, 2, 4, 6, 9, 10}), "Prometheus"},
+    {2, scaleMask({0, 1, 4, 6, 9, 10}), "Prometheus Neapolitan"},
+    {2, scaleMask({0, 1, 4, 6, 7, 9, 10}), "Romanian Major"},
+    {2, scaleMask({0, 2, 3, 4, 7, 8, 10}), "Sabach"},
+    {2, scaleMask({0, 2, 3, 4, 7, 8, 11}), "Sabach Maj7"},
+    {2, scaleMask({0, 2, 4, 5, 7, 9}), "Scottish Hexatonic"},
+    {2, scaleMask({0, 3, 4, 5, 7, 8, 11}), "Sengiach"},
+    {2, scaleMask({0, 1, 3, 4, 6, 7, 9, 11}), "Shostakovich"},
+    {2, scaleMask({0, 3, 4, 5, 6, 8, 10}), "Spanish Heptatonic"},
+    {2, scaleMask({0, 1, 3, 4, 5, 6, 8, 10}), "Spanish Octatonic"},
+
+    // Sheet 4: Modal Scales
+    {3, scaleMask({0, 2, 4, 5, 6, 9, 11}), "Ionian b5"},
+    {3, scaleMask({0, 2, 4, 5, 8, 9, 11}), "Ionian #5"},
+    {3, scaleMask({0, 3, 4, 5, 8, 9, 11}), "Ionian Augmented #2"},
+    {3, scaleMask({0, 1, 4, 5, 8, 9, 11}), "Ionian Augmented b9"},
+    {3, scaleMask({0, 2, 3, 5, 7, 10}), "Minor Hexatonic"},
+    {3, scaleMask({0, 2, 4, 5, 6, 8, 10}), "Major Locrian"},
+    {3, scaleMask({0, 2, 3, 5, 8, 9, 11}), "Jazz Minor #5"},
+    {3, scaleMask({0, 2, 3, 5, 7, 8, 9, 10, 11}), "Full Minor All Flats"},
+    {3, scaleMask({0, 2, 3, 5, 7, 8, 9, 10}), "Dorian Aeolian"},
+    {3, scaleMask({0, 1, 3, 4, 7, 9, 10}), "Dorian b2 b4"},
+    {3, scaleMask({0, 1, 3, 4, 6, 9, 11}), "Dorian b2 Maj7"},
+    {3, scaleMask({0, 1, 3, 6, 7, 9, 10}), "Dorian b9 #11"},
+    {3, scaleMask({0, 3, 5, 7, 8, 10}), "Phrygian Hexatonic"},
+    {3, scaleMask({0, 1, 2, 3, 5, 7, 8, 10}), "Phrygian Aeolian b4"},
+    {3, scaleMask({0, 1, 3, 4, 7, 8, 10}), "Phrygian b4"},
+    {3, scaleMask({0, 1, 3, 4, 7, 8, 11}), "Phrygian b4 Maj7"},
+    {3, scaleMask({0, 1, 3, 5, 6, 9}), "Double Phrygian"},
+    {3, scaleMask({0, 1, 3, 4, 7, 8, 9}), "Ultraphrygian"},
+    {3, scaleMask({0, 2, 4, 7, 9, 11}), "Lydian Hexatonic"},
+    {3, scaleMask({0, 3, 4, 7, 9, 11}), "Lydian #2 Hexatonic"},
+    {3, scaleMask({0, 3, 4, 6, 7, 10, 11}), "Lydian #2 #6"},
+    {3, scaleMask({0, 2, 4, 6, 7, 8, 10}), "Lydian Dominant b6"},
+    {3, scaleMask({0, 2, 4, 5, 6, 7, 9, 10, 11}), "Lydian Mixolydian"},
+    {3, scaleMask({0, 2, 3, 6, 7, 9, 11}), "Lydian Diminished"},
+    {3, scaleMask({0, 2, 4, 6, 7, 10, 11}), "Lydian #6"},
+    {3, scaleMask({0, 2, 4, 6, 8, 9, 10}), "Lydian Augmented Dominant"},
+    {3, scaleMask({0, 2, 5, 7, 9, 10}), "Mixolydian Hexatonic"},
+    {3, scaleMask({0, 2, 4, 5, 6, 9, 10}), "Mixolydian b5"},
+    {3, scaleMask({0, 2, 4, 5, 8, 9, 10}), "Mixolydian Augmented"},
+    {3, scaleMask({0, 1, 4, 5, 8, 9, 10}), "Mixolydian Augmented Maj9"},
+    {3, scaleMask({0, 3, 4, 6, 8, 9, 11}), "Aeolian b1"},
+    {3, scaleMask({0, 1, 4, 5, 6, 8, 10}), "Locrian Dominant"},
+    {3, scaleMask({0, 1, 3, 5, 6, 8, 9}), "Locrian bb7"},
+    {3, scaleMask({0, 1, 2, 5, 6, 8, 9}), "Locrian bb3 bb7"},
+    {3, scaleMask({0, 1, 3, 5, 6, 8, 11}), "Locrian Maj7"},
+    {3, scaleMask({0, 2, 3, 4, 6, 8, 10}), "Semilocrian b4"},
+    {3, scaleMask({0, 1, 2, 4, 6, 8, 10}), "Superlocrian bb3"},
+    {3, scaleMask({0, 1, 3, 4, 6, 8, 11}), "Superlocrian Maj7"},
+    {3, scaleMask({0, 1, 3, 4, 6, 7, 9}), "Superlocrian bb6 bb7"},
+    {3, scaleMask({0, 1, 3, 4, 6, 9, 10}), "Superlocrian #6"},
+    {3, scaleMask({0, 1, 2, 4, 6, 8, 9}), "Ultralocrian bb3"},
+    {3, scaleMask({0, 2, 4, 5, 7, 8, 11}), "Harmonic Major"},
+    {3, scaleMask({0, 2, 4, 5, 8, 9, 11}), "Harmonic Major 2"},
+    {3, scaleMask({0, 2, 3, 5, 6, 8, 11}), "Harmonic Minor b5"},
+    {3, scaleMask({0, 1, 4, 5, 7, 9, 10}), "Harmonic Minor Inverse"},
+    {3, scaleMask({0, 1, 4, 5, 7, 8, 11}), "Double Harmonic"},
+    {3, scaleMask({0, 1, 2, 5, 7, 8, 9}), "Chromatic Dorian"},
+    {3, scaleMask({0, 3, 4, 5, 7, 10, 11}), "Chromatic Dorian Inverse"},
+    {3, scaleMask({0, 1, 2, 3, 5, 7, 8, 9, 10}), "Chromatic Diatonic Dorian"},
+    {3, scaleMask({0, 3, 4, 5, 8, 10, 11}), "Chromatic Phrygian"},
+    {3, scaleMask({0, 1, 2, 4, 7, 8, 9}), "Chromatic Phrygian Inverse"},
+    {3, scaleMask({0, 1, 4, 5, 6, 9, 11}), "Chromatic Lydian"},
+    {3, scaleMask({0, 1, 3, 6, 7, 8, 11}), "Chromatic Lydian Inverse"},
+    {3, scaleMask({0, 1, 2, 5, 6, 7, 10}), "Chromatic Mixolydian"},
+    {3, scaleMask({0, 1, 2, 4, 6, 7, 10}), "Chromatic Mixolydian 2"},
+    {3, scaleMask({0, 2, 5, 6, 7, 10, 11}), "Chromatic Mixolydian Inverse"},
+    {3, scaleMask({0, 2, 3, 4, 7, 8, 9}), "Chromatic Hypodorian"},
+    {3, scaleMask({0, 3, 4, 5, 8, 9, 10}), "Chromatic Hypodorian Inverse"},
+    {3, scaleMask({0, 1, 4, 6, 7, 8, 11}), "Chromatic Hypolydian"},
+    {3, scaleMask({0, 1, 2, 5, 6, 7, 9}), "Chromatic Hypophrygian Inverse"},
+    {3, scaleMask({0, 1, 2, 4, 5, 7, 8, 9, 11}), "Chromatic Permutated Diatonic Dorian"},
+    {3, scaleMask({0, 2, 3, 4, 5, 7, 8, 9, 10, 11}), "Major Minor Mixed"},
+    {3, scaleMask({0, 2, 3, 4, 5, 6, 7, 9, 10, 11}), "Minor Pentatonic with Leading Tones"},
+    {3, scaleMask({0, 2, 4, 6, 8, 10, 11}), "Leading Whole-Tone"},
+
+    // Sheet 5: Pentatonic Scales
+    {4, scaleMask({0, 2, 4, 7, 9}), "Major Pentatonic"},
+    {4, scaleMask({0, 2, 5, 7, 10}), "Suspended Pentatonic"},
+    {4, scaleMask({0, 3, 5, 8, 10}), "Man Gong"},
+    {4, scaleMask({0, 2, 5, 7, 9}), "Ritusen"},
+    {4, scaleMask({0, 3, 5, 7, 10}), "Minor Pentatonic"},
+    {4, scaleMask({0, 2, 3, 7, 9}), "Dorian Pentatonic"},
+    {4, scaleMask({0, 1, 5, 7, 10}), "Kokin-Choshi"},
+    {4, scaleMask({0, 4, 6, 9, 11}), "Raga Hindol"},
+    {4, scaleMask({0, 2, 5, 7, 8}), "Han-Kumoi"},
+    {4, scaleMask({0, 3, 5, 6, 10}), "Minor Pentatonic 7 b5"},
+    {4, scaleMask({0, 4, 5, 7, 11}), "Ionian Pentatonic"},
+    {4, scaleMask({0, 1, 3, 7, 8}), "Pelog Pentatonic"},
+    {4, scaleMask({0, 2, 6, 7, 11}), "Raga Hamsanada"},
+    {4, scaleMask({0, 4, 5, 9, 10}), "Raga Khamaji Durga"},
+    {4, scaleMask({0, 2, 4, 7, 10}), "Dominant Pentatonic"},
+    {4, scaleMask({0, 2, 5, 8, 10}), "Chaio"},
+    {4, scaleMask({0, 3, 6, 8, 10}), "Chin"},
+    {4, scaleMask({0, 3, 5, 7, 9}), "Kyemyonjo"},
+    {4, scaleMask({0, 2, 4, 6, 9}), "Kung"},
+    {4, scaleMask({0, 1, 5, 7, 8}), "In"},
+    {4, scaleMask({0, 4, 6, 7, 11}), "Hirajoshi"},
+    {4, scaleMask({0, 2, 3, 7, 8}), "Ake-Bono"},
+    {4, scaleMask({0, 1, 5, 6, 10}), "Iwato"},
+    {4, scaleMask({0, 1, 4, 7, 9}), "Major Pentatonic b2"},
+    {4, scaleMask({0, 1, 4, 6, 9}), "Major Pentatonic b2 b5"},
+    {4, scaleMask({0, 1, 3, 6, 9}), "Major Pentatonic b3"},
+    {4, scaleMask({0, 2, 4, 7, 8}), "Major Pentatonic b6"},
+    {4, scaleMask({0, 3, 4, 7, 10}), "Major Pentatonic b7 #9"},
+    {4, scaleMask({0, 4, 5, 7, 10}), "Mixolydian Pentatonic"},
+    {4, scaleMask({0, 2, 5, 7, 11}), "Tcherepnin Major Pentatonic"},
+    {4, scaleMask({0, 1, 5, 7, 9}), "Altered Pentatonic"},
+    {4, scaleMask({0, 3, 4, 6, 10}), "Locrian Pentatonic"},
+    {4, scaleMask({0, 4, 6, 8, 10}), "Pentatonic Whole-Tone"},
+    {4, scaleMask({0, 3, 4, 5, 8}), "Center-Cluster PentaMirror"},
+    {4, scaleMask({0, 4, 5, 7, 9}), "Raga Nagaswaravali"},
+    {4, scaleMask({0, 1, 3, 5, 8}), "Raga Chitthakarshini"},
+    {4, scaleMask({0, 2, 4, 7, 11}), "Raga Hamsadhvani 2"},
+    {4, scaleMask({0, 2, 5, 9, 10}), "Pyeong Jo"},
+    {4, scaleMask({0, 3, 7, 8, 10}), "Raga Shailaja"},
+    {4, scaleMask({0, 2, 3, 7, 10}), "Pygmy"},
+    {4, scaleMask({0, 4, 7, 9, 11}), "Raga Mamata"},
+    {4, scaleMask({0, 3, 5, 7, 8}), "Raga Kokil Pancham"},
+    {4, scaleMask({0, 4, 5, 8, 11}), "Romanian Bacovia"},
+    {4, scaleMask({0, 1, 4, 5, 8}), "Syrian Pentatonic"},
+
+    // Sheet 6: Jazz Scales
+    {5, scaleMask({0, 3, 5, 6, 7, 10}), "Blues"},
+    {5, scaleMask({0, 2, 3, 5, 6, 9, 10}), "Blues Heptatonic"},
+    {5, scaleMask({0, 3, 5, 6, 7, 9, 10}), "Blues Heptatonic 2"},
+    {5, scaleMask({0, 2, 3, 5, 6, 7, 9, 10}), "Blues Octatonic"},
+    {5, scaleMask({0, 2, 3, 4, 5, 7, 9, 10, 11}), "Blues Enneatonic"},
+    {5, scaleMask({0, 2, 3, 4, 5, 6, 7, 9, 10}), "Blues Enneatonic 2"},
+    {5, scaleMask({0, 1, 3, 4, 7, 9}), "Blues Dorian Hexatonic"},
+    {5, scaleMask({0, 1, 3, 5, 6, 7, 10}), "Blues Phrygian"},
+    {5, scaleMask({0, 3, 5, 6, 7, 11}), "Blues Minor Maj7"},
+    {5, scaleMask({0, 2, 3, 5, 6, 7, 10}), "Blues Modified"},
+    {5, scaleMask({0, 3, 5, 6, 7, 10, 11}), "Blues Leading Tone"},
+    {5, scaleMask({0, 3, 4, 5, 7, 9, 10}), "Rock 'n Roll"},
+    {5, scaleMask({0, 2, 4, 5, 7, 9, 10, 11}), "Bebop"},
+    {5, scaleMask({0, 2, 4, 5, 7, 8, 9, 11}), "Bebop Major"},
+    {5, scaleMask({0, 2, 4, 7, 8, 9}), "Bebop Major Hexatonic"},
+    {5, scaleMask({0, 2, 4, 5, 7, 8, 9}), "Bebop Major Heptatonic"},
+    {5, scaleMask({0, 2, 3, 4, 7, 9, 10}), "Bebop Minor"},
+    {5, scaleMask({0, 2, 3, 4, 5, 7, 9, 10}), "Bebop Dorian"},
+    {5, scaleMask({0, 2, 3, 5, 7, 8, 9, 11}), "Bebop Melodic Minor"},
+    {5, scaleMask({0, 2, 3, 5, 7, 8, 10, 11}), "Bebop Harmonic Minor"},
+    {5, scaleMask({0, 1, 3, 5, 6, 7, 8, 11}), "Bebop Half-diminished"},
+    {5, scaleMask({0, 1, 3, 5, 6, 7, 8, 10}), "Bebop Locrian"},
+    {5, scaleMask({0, 1, 2, 4, 5, 7, 9, 10, 11}), "Bebop Chromatic"},
+
+    // Sheet 7: Asian Scales
+    {6, scaleMask({0, 1, 3, 5, 6, 10}), "Honkoshi"},
+    {6, scaleMask({0, 2, 4, 5, 6, 7, 9, 11}), "Ichilkotsucho"},
+    {6, scaleMask({0, 1, 5, 7, 8, 10}), "Insen"},
+    {6, scaleMask({0, 1, 3, 4, 5, 6, 9, 10}), "Maqam Shadd'araban"},
+    {6, scaleMask({0, 1, 4, 5, 7, 8, 10, 11}), "Maqam Hijaz"},
+    {6, scaleMask({0, 2, 3, 4, 5, 6, 7, 8, 9, 11}), "Maqam Shawq Afza"},
+    {6, scaleMask({0, 1, 3, 4, 5, 6, 7, 8, 9, 10}), "Maqam Tarzanuyn"},
+    {6, scaleMask({0, 2, 3, 5, 7}), "Nando-Kyemyonjo"},
+    {6, scaleMask({0, 2, 5, 7, 8, 9, 11}), "Noh"},
+    {6, scaleMask({0, 2, 5, 6, 8, 9, 11}), "Nohkan"},
+    {6, scaleMask({0, 1, 4, 5, 6, 9, 10}), "Oriental"},
+    {6, scaleMask({0, 1, 4, 5, 6, 9, 10, 11}), "Oriental 2"},
+    {6, scaleMask({0, 2, 4, 6, 7, 8, 11}), "Pelog"},
+    {6, scaleMask({0, 1, 4, 5, 6, 8, 11}), "Persian"},
+    {6, scaleMask({0, 1, 3, 5, 8, 10}), "Ritzu"},
+    {6, scaleMask({0, 2, 3, 5, 7, 9}), "Sho"},
+    {6, scaleMask({0, 1, 3, 4, 6, 10}), "Sho #2"},
+    {6, scaleMask({0, 2, 3, 6, 8, 11}), "Takemitzu Tree 1"},
+    {6, scaleMask({0, 2, 3, 6, 8, 10}), "Takemitzu Tree 2"},
+    {6, scaleMask({0, 1, 2, 4, 5, 6, 7, 9, 10}), "Youlan"},
+
+    // Sheet 8: Indian Scales
+    {7, scaleMask({0, 1, 3, 6, 7, 8, 10}), "Mela Bhavapriya"},
+    {7, scaleMask({0, 3, 4, 5, 7, 10}), "Mela Calanata"},
+    {7, scaleMask({0, 1, 4, 6, 7, 8, 9}), "Mela Dhavalambari"},
+    {7, scaleMask({0, 3, 4, 6, 7, 8, 11}), "Mela Dhatuvardhani"},
+    {7, scaleMask({0, 1, 3, 6, 7, 10, 11}), "Mela Divyamani"},
+    {7, scaleMask({0, 1, 2, 5, 7, 8, 11}), "Mela Ganamurti"},
+    {7, scaleMask({0, 1, 3, 6, 7, 8, 9}), "Mela Gavambodhi"},
+    {7, scaleMask({0, 1, 4, 5, 7, 9, 10, 11}), "Mela Gayakapriya"},
+    {7, scaleMask({0, 1, 4, 5, 7, 10, 11}), "Mela Hatakambari"},
+    {7, scaleMask({0, 1, 2, 5, 6, 7, 9, 11}), "Mela Jalarnava"},
+    {7, scaleMask({0, 1, 2, 5, 6, 7, 10, 11}), "Mela Jhalavarli"},
+    {7, scaleMask({0, 2, 3, 5, 7, 8, 9}), "Mela Jhankaradhvani"},
+    {7, scaleMask({0, 3, 4, 6, 7, 8, 10}), "Mela Jyotisvarupini"},
+    {7, scaleMask({0, 2, 4, 6, 7, 8, 9}), "Mela Kantamani"},
+    {7, scaleMask({0, 1, 2, 5, 7, 9, 11}), "Mela Manavati"},
+    {7, scaleMask({0, 2, 4, 5, 7, 10, 11}), "Mela Naganandini"},
+    {7, scaleMask({0, 1, 4, 6, 7, 8, 10}), "Mela Namanarayani"},
+    {7, scaleMask({0, 1, 2, 6, 7, 9, 10}), "Mela Navanitam"},
+    {7, scaleMask({0, 2, 3, 6, 7, 10, 11}), "Mela Nitimati"},
+    {7, scaleMask({0, 1, 2, 6, 7, 9, 11}), "Mela Pavani"},
+    {7, scaleMask({0, 3, 4, 5, 7, 8, 10}), "Mela Ragavardhani"},
+    {7, scaleMask({0, 1, 2, 6, 7, 10, 11}), "Mela Raghupriya"},
+    {7, scaleMask({0, 1, 2, 5, 7, 8, 10}), "Mela Ratnangi"},
+    {7, scaleMask({0, 1, 3, 5, 7, 10, 11}), "Mela Rupavati"},
+    {7, scaleMask({0, 1, 2, 6, 7, 8, 9}), "Mela Salaga"},
+    {7, scaleMask({0, 2, 3, 6, 7, 8, 9}), "Mela Syamalangi"},
+    {7, scaleMask({0, 1, 3, 6, 7, 9, 11}), "Mela Suvarnangi"},
+    {7, scaleMask({0, 1, 2, 5, 7, 10, 11}), "Mela Tenarupi"},
+    {7, scaleMask({0, 1, 2, 5, 7, 9, 10}), "Mela Venaspati"},
+    {7, scaleMask({0, 2, 3, 5, 7, 10, 11}), "Mela Varunapriya"},
+    {7, scaleMask({0, 1, 4, 6, 7, 10, 11}), "Mela Visvambhari"},
+    {7, scaleMask({0, 3, 4, 5, 7, 8, 9}), "Mela Yagapriya"},
+    {7, scaleMask({0, 2, 3, 5, 9}), "Raga Abhogi"},
+    {7, scaleMask({0, 2, 4, 6, 7, 9}), "Raga Aivarati"},
+    {7, scaleMask({0, 2, 3, 6, 7, 11}), "Raga Amarasenapriya"},
+    {7, scaleMask({0, 2, 3, 5, 8}), "Raga Audav Tukhari"},
+    {7, scaleMask({0, 1, 4, 5, 6, 7, 9, 11}), "Raga Bhatiyar"},
+    {7, scaleMask({0, 2, 5, 7, 8, 11}), "Raga Bhinna Pancama"},
+    {7, scaleMask({0, 2, 5, 7, 10, 11}), "Raga Brindabani"},
+    {7, scaleMask({0, 1, 4, 7, 8}), "Raga Bowli (asc)"},
+    {7, scaleMask({0, 1, 4, 7, 8, 11}), "Raga Bowli (desc)"},
+    {7, scaleMask({0, 2, 4, 5, 7}), "Raga Budhamanohari"},
+    {7, scaleMask({0, 1, 2, 6, 7, 9}), "Raga Chandrajyoti"},
+    {7, scaleMask({0, 3, 5, 9, 10}), "Raga Chandrakauns Kafi"},
+    {7, scaleMask({0, 3, 5, 8, 11}), "Raga Chandrakauns Kiravani"},
+    {7, scaleMask({0, 3, 5, 9, 11}), "Raga Chandrakauns Modern"},
+    {7, scaleMask({0, 1, 3, 6, 8}), "Raga Chaya Todi"},
+    {7, scaleMask({0, 2, 3, 6, 7, 8, 9, 10}), "Raga Chinthamani"},
+    {7, scaleMask({0, 1, 7, 8, 11}), "Raga Deshgaur"},
+    {7, scaleMask({0, 5, 7, 8, 11}), "Raga Devaranjani"},
+    {7, scaleMask({0, 1, 4, 6, 7, 8}), "Raga Dhavalangam"},
+    {7, scaleMask({0, 4, 6, 7, 9}), "Raga Dhavalashri"},
+    {7, scaleMask({0, 2, 4, 5, 6, 7}), "Raga Dipak"},
+    {7, scaleMask({0, 1, 4, 6, 7, 11}), "Raga Gamakakriya"},
+    {7, scaleMask({0, 1, 3, 5, 7, 10}), "Raga Gandharavam"},
+    {7, scaleMask({0, 4, 5, 6, 8, 11}), "Raga Gangatarangini"},
+    {7, scaleMask({0, 1, 4, 5, 7, 10}), "Raga Gaula"},
+    {7, scaleMask({0, 3, 6, 7, 10, 11}), "Raga Gaurikriya"},
+    {7, scaleMask({0, 2, 3, 5, 8, 11}), "Raga Ghantana"},
+    {7, scaleMask({0, 2, 3, 6, 7, 10}), "Raga Gopikatilaka"},
+    {7, scaleMask({0, 1, 5, 7, 11}), "Raga Gowla (asc)"},
+    {7, scaleMask({0, 1, 4, 5, 7, 11}), "Raga Gowla (desc)"},
+    {7, scaleMask({0, 1, 3, 6, 8, 10}), "Raga Gurjari Todi"},
+    {7, scaleMask({0, 2, 3, 7, 11}), "Raga Hamsadhvani"},
+    {7, scaleMask({0, 1, 4, 6, 9, 11}), "Raga Hansanandi"},
+    {7, scaleMask({0, 2, 4, 5, 9, 11}), "Raga Hamsa Vinodini"},
+    {7, scaleMask({0, 4, 5, 7, 9, 11}), "Raga Hari Nata"},
+    {7, scaleMask({0, 1, 4, 6, 8, 9}), "Raga Hejjajji"},
+    {7, scaleMask({0, 2, 6, 7, 8, 10}), "Raga Jaganmohanam"},
+    {7, scaleMask({0, 1, 5, 7, 9, 11}), "Raga Jivantika"},
+    {7, scaleMask({0, 4, 6, 7, 8, 10}), "Raga Jyoty"},
+    {7, scaleMask({0, 1, 4, 7, 8, 9}), "Raga Kalagada"},
+    {7, scaleMask({0, 2, 3, 7, 8, 9}), "Raga Kalakanthi"},
+    {7, scaleMask({0, 1, 4, 5, 7, 9}), "Raga Kalavati"},
+    {7, scaleMask({0, 2, 6, 7, 9, 10}), "Raga Kamalamanohari"},
+    {7, scaleMask({0, 1, 3, 7, 8, 10}), "Raga Kashyapi"},
+    {7, scaleMask({0, 4, 5, 7, 11}), "Raga Kedaram (asc)"},
+    {7, scaleMask({0, 2, 4, 5, 7, 11}), "Raga Kedaram (desc)"},
+    {7, scaleMask({0, 4, 5, 7, 9, 10, 11}), "Raga Khamach (asc)"},
+    {7, scaleMask({0, 2, 4, 5, 7, 9, 10}), "Raga Khamach (desc)"},
+    {7, scaleMask({0, 1, 5, 8, 11}), "Raga Kshanika"},
+    {7, scaleMask({0, 1, 2, 8, 11}), "Raga Kumarapriya"},
+    {7, scaleMask({0, 2, 4, 6, 11}), "Raga Kumurdaki"},
+    {7, scaleMask({0, 5, 7, 9, 10}), "Raga Kuntvarali"},
+    {7, scaleMask({0, 1, 4, 5, 8, 11}), "Raga Lalita"},
+    {7, scaleMask({0, 1, 4, 5, 8, 10}), "Raga Lalita Bhairav"},
+    {7, scaleMask({0, 2, 4, 7, 8, 11}), "Raga Latika"},
+    {7, scaleMask({0, 3, 6, 7, 9, 10}), "Raga Madhukauns"},
+    {7, scaleMask({0, 2, 6, 7, 10, 11}), "Raga Malarani"},
+    {7, scaleMask({0, 1, 4, 7, 9, 10}), "Raga Malayamarutam"},
+    {7, scaleMask({0, 1, 5, 7, 8}), "Raga Malahari (asc)"},
+    {7, scaleMask({0, 1, 4, 5, 7, 8}), "Raga Malahari (desc)"},
+    {7, scaleMask({0, 3, 5, 8, 10, 11}), "Raga Malkauns"},
+    {7, scaleMask({0, 1, 3, 5, 7, 8, 9}), "Raga Malini"},
+    {7, scaleMask({0, 1, 4, 7, 10}), "Raga Manaranjani"},
+    {7, scaleMask({0, 2, 3, 7, 9, 10}), "Raga Manavi"},
+    {7, scaleMask({0, 3, 5, 7, 9, 10}), "Raga Manohari"},
+    {7, scaleMask({0, 1, 4, 6, 7, 9, 11}), "Raga Marwa Thaat"},
+    {7, scaleMask({0, 2, 7, 9, 10}), "Raga Matha Kokila"},
+    {7, scaleMask({0, 1, 4, 5, 11}), "Raga Megharamji"},
+    {7, scaleMask({0, 2, 3, 5, 7, 9, 10, 11}), "Raga Miam Ki Malhar"},
+    {7, scaleMask({0, 3, 4, 7, 9}), "Raga Mohanangi"},
+    {7, scaleMask({0, 2, 4, 6, 9, 11}), "Raga Mruganandana"},
+    {7, scaleMask({0, 2, 5, 8, 9, 11}), "Raga Multani"},
+    {7, scaleMask({0, 1, 2, 6, 7}), "Raga Nabhomani"},
+    {7, scaleMask({0, 2, 5, 7, 9, 11}), "Raga Nagagandhari"},
+    {7, scaleMask({0, 3, 4, 5, 7, 10, 11}), "Raga Nattai (asc)"},
+    {7, scaleMask({0, 3, 5, 7, 11}), "Raga Nattai (desc)"},
+    {7, scaleMask({0, 2, 4, 5, 9, 10}), "Raga Nattaikurinji"},
+    {7, scaleMask({0, 2, 5, 7, 8, 10}), "Raga Navamanohari"},
+    {7, scaleMask({0, 2, 4, 9, 11}), "Raga Neroshta"},
+    {7, scaleMask({0, 2, 6, 7, 9, 11}), "Raga Nishadi"},
+    {7, scaleMask({0, 1, 5, 7, 8, 11}), "Raga Padi"},
+    {7, scaleMask({0, 2, 4, 5, 7, 8, 9, 10, 11}), "Raga Pahadi"},
+    {7, scaleMask({0, 4, 5, 7, 8, 11}), "Raga Paras (asc)"},
+    {7, scaleMask({0, 1, 4, 5, 7, 8, 11}), "Raga Paras (desc)"},
+    {7, scaleMask({0, 2, 5, 8, 11}), "Raga Priyadharshini"},
+    {7, scaleMask({0, 5, 7, 9, 11}), "Raga Puruhutika"},
+    {7, scaleMask({0, 1, 2, 8, 9}), "Raga Putrika"},
+    {7, scaleMask({0, 2, 4, 5, 9, 10, 11}), "Raga Rageshri"},
+    {7, scaleMask({0, 1, 4, 5, 6, 7, 8, 11}), "Raga Ramkali"},
+    {7, scaleMask({0, 2, 3, 6, 9, 11}), "Raga Rangini"},
+    {7, scaleMask({0, 2, 5, 6, 8, 9, 11}), "Raga Rasamanjari"},
+    {7, scaleMask({0, 1, 5, 7, 9, 10}), "Raga Rasavali"},
+    {7, scaleMask({0, 2, 5, 9, 11}), "Raga Rasranjani"},
+    {7, scaleMask({0, 2, 4, 6, 7, 11}), "Raga Ratnakanthi"},
+    {7, scaleMask({0, 1, 4, 5, 9, 10}), "Raga Rudra Pancama"},
+    {7, scaleMask({0, 1, 3, 7, 10}), "Raga Rukmangi"},
+    {7, scaleMask({0, 1, 3, 7, 9, 10}), "Raga Salagavarali"},
+    {7, scaleMask({0, 3, 6, 7, 10}), "Raga Samudhra Priya"},
+    {7, scaleMask({0, 3, 4, 6, 7, 8, 9}), "Raga Santanamanjari"},
+    {7, scaleMask({0, 2, 4, 5, 8, 11}), "Raga Sarasanana"},
+    {7, scaleMask({0, 2, 6, 7, 9, 10}), "Raga Sarasvati"},
+    {7, scaleMask({0, 4, 5, 7, 8, 9}), "Raga Saravati"},
+    {7, scaleMask({0, 1, 6, 7, 8}), "Raga Saugandhini"},
+    {7, scaleMask({0, 1, 4, 5, 7, 8, 9, 11}), "Raga Saurashtra"},
+    {7, scaleMask({0, 2, 3, 5, 9, 10}), "Raga Shreeranjani"},
+    {7, scaleMask({0, 2, 6, 7, 9}), "Raga Shri Kalyan"},
+    {7, scaleMask({0, 2, 6, 9, 10}), "Raga Shubravarni"},
+    {7, scaleMask({0, 2, 3, 5, 7, 11}), "Raga Sindhura Kafi"},
+    {7, scaleMask({0, 1, 2, 3, 4, 5, 7, 8, 10, 11}), "Raga Sindhi-Bhairavi"},
+    {7, scaleMask({0, 2, 4, 5, 7, 10}), "Raga Siva Kambhoji"},
+    {7, scaleMask({0, 2, 5, 7, 9, 10, 11}), "Raga Sorati"},
+    {7, scaleMask({0, 1, 2, 5, 8, 9}), "Raga Suddha Mukhari"},
+    {7, scaleMask({0, 1, 3, 5, 7, 8}), "Raga Suddha Simantini"},
+    {7, scaleMask({0, 2, 3, 6, 7, 8}), "Raga Syamalam"},
+    {7, scaleMask({0, 3, 5, 7, 8, 11}), "Raga Takka"},
+    {7, scaleMask({0, 4, 5, 7, 10, 11}), "Raga Tilang"},
+    {7, scaleMask({0, 2, 3, 7, 8, 10}), "Raga Trimurti"},
+    {7, scaleMask({0, 4, 7, 9, 10}), "Raga Valaji"},
+    {7, scaleMask({0, 4, 5, 9, 11}), "Raga Vasanta (asc)"},
+    {7, scaleMask({0, 1, 4, 5, 9, 11}), "Raga Vasanta (desc)"},
+    {7, scaleMask({0, 4, 5, 7, 9, 10}), "Raga Vegavahini (asc)"},
+    {7, scaleMask({0, 1, 4, 5, 7, 9, 10}), "Raga Vegavahini (desc)"},
+    {7, scaleMask({0, 2, 3, 6, 7, 9}), "Raga Vijayanagari"},
+    {7, scaleMask({0, 1, 2, 6, 7, 11}), "Raga Vijayasri"},
+    {7, scaleMask({0, 4, 6, 7, 10, 11}), "Raga Vijayavasanta"},
+    {7, scaleMask({0, 1, 3, 5, 8, 11}), "Raga Viyogavarali"},
+    {7, scaleMask({0, 4, 6, 7, 9, 10}), "Raga Vutari"},
+    {7, scaleMask({0, 4, 6, 7, 9, 10}), "Raga Zilaf"},
+
+    // Sheet 9: Miscellaneous scales
+    {8, scaleMask({0, 2, 3, 5, 6, 7, 8, 11}), "Algerian Octatonic"},
+    {8, scaleMask({0, 2, 3, 6, 7, 8, 11}), "Algerian"},
+    {8, scaleMask({0, 2, 4, 6, 8, 9}), "Eskimo Hexatonic"},
+    {8, scaleMask({0, 2, 4, 6, 8, 11}), "Eskimo Hexatonic 2"},
+    {8, scaleMask({0, 1, 3, 5, 7, 8, 10, 11}), "Hamel"},
+    {8, scaleMask({0, 2, 3, 7, 9, 11}), "Hawaiian"},
+    {8, scaleMask({0, 1, 3, 4, 5, 7, 9, 10}), "LG Octatonic"},
+    {8, scaleMask({0, 2, 3, 5, 6, 9}), "Pyramid Hexatonic"},
+    {8, scaleMask({0, 1, 3, 4, 5, 6, 7, 9, 10}), "Nonatonic 2"},
+    {8, scaleMask({0, 1, 2, 4, 6, 7, 8, 10, 11}), "Symmetrical Nonatonic"},
+};
+
+inline constexpr size_t SCALE_CATALOG_SIZE = sizeof(SCALE_CATALOG) / sizeof(SCALE_CATALOG[0]);
+inline constexpr size_t SCALE_SHEET_COUNT = sizeof(SCALE_SHEETS) / sizeof(SCALE_SHEETS[0]);
+
+/**
+ * @brief Contiguous run of entry indices in a PackedScaleCatalog index
+ */
+struct ScaleIndexRange {
+    const uint32_t* first;
+    const uint32_t* last;
+
+    const uint32_t* begin() const { return first; }
+    const uint32_t* end() const { return last; }
+    size_t size() const { return static_cast<size_t>(last - first); }
+    bool empty() const { return first == last; }
+};
+
+/**
+ * @class PackedScaleCatalog
+ * @brief Read-only view of a packed scale catalog image
+ *
+ * @details The view never copies or owns the image, which must outlive it. Image layout,
+ *          in 32-bit words:
+ *          - header: magic, version, scale count, sheet count, string bytes
+ *          - cardinality starts (MOD + 2): bucket c of byCardinality is [start[c], start[c + 1])
+ *          - entries (2 per scale): name offset, sheet | mask << 16
+ *          - byCardinality, byMask, byClass (scale count each): entry indices ordered by
+ *            cardinality, mask or transposition class, then by catalog index
+ *          - sheets (sheet count): sheet name offsets
+ *          - strings: NUL-terminated names, padded to a whole word
+ */
+class PackedScaleCatalog {
+public:
+    static constexpr uint32_t MAGIC = 0x54414353;  ///< "SCAT" read as a little-endian word
+    static constexpr uint32_t VERSION = 1;
+    static constexpr int MOD = 12;
+
+private:
+    static constexpr size_t HEADER_WORDS = 5;
+    static constexpr size_t CARDINALITY_WORDS = MOD + 2;
+
+    const uint32_t* words_;
+    size_t wordCount_;
+    size_t scaleCount_;
+    size_t sheetCount_;
+    size_t stringBytes_;
+    const uint32_t* cardinalityStart_;
+    const uint32_t* entries_;
+    const uint32_t* byCardinality_;
+    const uint32_t* byMask_;
+    const uint32_t* byClass_;
+    const uint32_t* sheets_;
+    const char* strings_;
+
+    static size_t wordsFor(size_t scales, size_t sheets, size_t stringBytes) {
+        return HEADER_WORDS + CARDINALITY_WORDS + 5 * scales + sheets + (stringBytes + 3) / 4;
+    }
+
+    static uint16_t transpositionClassOf(uint16_t mask) {
+        return static_cast<uint16_t>(PitchClassMask::fromBits(mask, MOD).transpositionClass().getBits());
+    }
+
+    // Entries of a sorted index whose key equals key
+    template<typename Key>
+    ScaleIndexRange equalRange(const uint32_t* index, uint16_t key, Key keyOf) const {
+        const uint32_t* first = lower_bound(index, index + scaleCount_, key,
+            [&](uint32_t i, uint16_t k) { return keyOf(i) < k; });
+        const uint32_t* last = upper_bound(first, index + scaleCount_, key,
+            [&](uint16_t k, uint32_t i) { return k < keyOf(i); });
+        return {first, last};
+    }
+
+public:
+    // ==================== CONSTRUCTORS ====================
+
+    /**
+     * @brief Views a packed image
+     * @param data Start of the image, aligned to 4 bytes
+     * @param bytes Size of the image in bytes
+     * @throw invalid_argument If the image is misaligned, truncated, of another version
+     *        or byte order, or has out-of-range offsets or indices
+     */
+    PackedScaleCatalog(const void* data, size_t bytes) {
+        if (reinterpret_cast<uintptr_t>(data) % alignof(uint32_t) != 0) {
+            throw invalid_argument("Scale catalog image must be 4-byte aligned");
+        }
+        words_ = static_cast<const uint32_t*>(data);
+        wordCount_ = bytes / sizeof(uint32_t);
+        if (wordCount_ < HEADER_WORDS || words_[0] != MAGIC || words_[1] != VERSION) {
+            throw invalid_argument("Not a scale catalog image of this version");
+        }
+        scaleCount_ = words_[2];
+        sheetCount_ = words_[3];
+        stringBytes_ = words_[4];
+        if (wordCount_ < wordsFor(scaleCount_, sheetCount_, stringBytes_)) {
+            throw invalid_argument("Truncated scale catalog image");
+        }
+
+        cardinalityStart_ = words_ + HEADER_WORDS;
+        entries_ = cardinalityStart_ + CARDINALITY_WORDS;
+        byCardinality_ = entries_ + 2 * scaleCount_;
+        byMask_ = byCardinality_ + scaleCount_;
+        byClass_ = byMask_ + scaleCount_;
+        sheets_ = byClass_ + scaleCount_;
+        strings_ = reinterpret_cast<const char*>(sheets_ + sheetCount_);
+
+        bool valid = stringBytes_ > 0 && strings_[stringBytes_ - 1] == '\0'
+                     && cardinalityStart_[0] == 0 && cardinalityStart_[MOD + 1] == scaleCount_;
+        for (size_t c = 0; valid && c <= MOD; ++c) {
+            valid = cardinalityStart_[c] <= cardinalityStart_[c + 1];
+        }
+        for (size_t i = 0; valid && i < scaleCount_; ++i) {
+            valid = entries_[2 * i] < stringBytes_ && sheet(i) < sheetCount_ && mask(i) < (1u << MOD)
+                    && byCardinality_[i] < scaleCount_ && byMask_[i] < scaleCount_ && byClass_[i] < scaleCount_;
+        }
+        for (size_t s = 0; valid && s < sheetCount_; ++s) {
+            valid = sheets_[s] < stringBytes_;
+        }
+        if (!valid) {
+            throw invalid_argument("Corrupt scale catalog image");
+        }
+    }
+
+    /**
+     * @brief Packs a catalog into an image
+     * @param entries Catalog entries, in catalog order
+     * @param count Number of entries
+     * @param sheets Sheet names, indexed by ScaleCatalogEntry::sheet
+     * @param sheetCount Number of sheet names
+     * @return Image words, to be viewed with PackedScaleCatalog or written to disk
+     * @throw invalid_argument If an entry has an unknown sheet or a mask wider than 12 bits
+     */
+    static vector<uint32_t> build(const ScaleCatalogEntry* entries, size_t count,
+                                  const char* const* sheets, size_t sheetCount) {
+        string strings;
+        vector<uint32_t> sheetOffsets(sheetCount);
+        for (size_t s = 0; s < sheetCount; ++s) {
+            sheetOffsets[s] = static_cast<uint32_t>(strings.size());
+            strings.append(sheets[s]).push_back('\0');
+        }
+        vector<uint32_t> nameOffsets(count);
+        for (size_t i = 0; i < count; ++i) {
+            if (entries[i].sheet >= sheetCount || entries[i].mask >= (1u << MOD)) {
+                throw invalid_argument("Scale catalog entry has an unknown sheet or an invalid mask");
+            }
+            nameOffsets[i] = static_cast<uint32_t>(strings.size());
+            strings.append(entries[i].name).push_back('\0');
+        }
+
+        vector<uint32_t> image(wordsFor(count, sheetCount, strings.size()), 0);
+        image[0] = MAGIC;
+        image[1] = VERSION;
+        image[2] = static_cast<uint32_t>(count);
+        image[3] = static_cast<uint32_t>(sheetCount);
+        image[4] = static_cast<uint32_t>(strings.size());
+
+        uint32_t* cardinalityStart = image.data() + HEADER_WORDS;
+        uint32_t* packedEntries = cardinalityStart + CARDINALITY_WORDS;
+        uint32_t* byCardinality = packedEntries + 2 * count;
+        uint32_t* byMask = byCardinality + count;
+        uint32_t* byClass = byMask + count;
+        uint32_t* sheetTable = byClass + count;
+
+        for (size_t i = 0; i < count; ++i) {
+            packedEntries[2 * i] = nameOffsets[i];
+            packedEntries[2 * i + 1] = entries[i].sheet | (static_cast<uint32_t>(entries[i].mask) << 16);
+            ++cardinalityStart[popcount64(entries[i].mask) + 1];
+        }
+        partial_sum(cardinalityStart, cardinalityStart + CARDINALITY_WORDS, cardinalityStart);
+
+        iota(byCardinality, byCardinality + count, 0u);
+        iota(byMask, byMask + count, 0u);
+        iota(byClass, byClass + count, 0u);
+        auto sortBy = [&](uint32_t* index, auto keyOf) {
+            stable_sort(index, index + count, [&](uint32_t a, uint32_t b) { return keyOf(a) < keyOf(b); });
+        };
+        sortBy(byCardinality, [&](uint32_t i) { return popcount64(entries[i].mask); });
+        sortBy(byMask, [&](uint32_t i) { return entries[i].mask; });
+        vector<uint16_t> classes(count);
+        for (size_t i = 0; i < count; ++i) {
+            classes[i] = transpositionClassOf(entries[i].mask);
+        }
+        sortBy(byClass, [&](uint32_t i) { return classes[i]; });
+
+        copy(sheetOffsets.begin(), sheetOffsets.end(), sheetTable);
+        memcpy(sheetTable + sheetCount, strings.data(), strings.size());
+        return image;
+    }
+
+    /**
+     * @brief The built-in catalog, packed once per process on first use
+     * @return Shared read-only view, safe to use from any thread
+     */
+    static const PackedScaleCatalog& builtin() {
+        static const vector<uint32_t> image = build(SCALE_CATALOG, SCALE_CATALOG_SIZE,
+                                                    SCALE_SHEETS, SCALE_SHEET_COUNT);
+        static const PackedScaleCatalog catalog(image.data(), image.size() * sizeof(uint32_t));
+        return catalog;
+    }
+
+    // ==================== ACCESS ====================
+
+    size_t size() const { return scaleCount_; }
+    size_t sheetCount() const { return sheetCount_; }
+
+    uint16_t mask(size_t i) const { return static_cast<uint16_t>(entries_[2 * i + 1] >> 16); }
+    uint16_t sheet(size_t i) const { return static_cast<uint16_t>(entries_[2 * i + 1] & 0xFFFF); }
+    const char* name(size_t i) const { return strings_ + entries_[2 * i]; }
+    const char* sheetName(size_t i) const { return strings_ + sheets_[sheet(i)]; }
+
+    /**
+     * @brief Intervals of entry i in ascending order
+     */
+    vector<int> intervals(size_t i) const {
+        vector<int> result;
+        for (uint64_t w = mask(i); w != 0; w &= w - 1) {
+            result.push_back(ctz64(w));
+        }
+        return result;
+    }
+
+    /**
+     * @brief Raw image, e.g. to write it to disk
+     */
+    const void* data() const { return words_; }
+    size_t byteSize() const { return wordsFor(scaleCount_, sheetCount_, stringBytes_) * sizeof(uint32_t); }
+
+    // ==================== INDEXES ====================
+
+    /**
+     * @brief Entries with exactly this pitch-class mask, in catalog order
+     */
+    ScaleIndexRange withMask(uint16_t key) const {
+        return equalRange(byMask_, key, [this](uint32_t i) { return mask(i); });
+    }
+
+    /**
+     * @brief Entries that are transpositions of the given mask, in catalog order
+     */
+    ScaleIndexRange withTranspositionClass(uint16_t key) const {
+        return equalRange(byClass_, transpositionClassOf(key),
+                          [this](uint32_t i) { return transpositionClassOf(mask(i)); });
+    }
+
+    /**
+     * @brief Entries with cardinality in [minNotes, maxNotes], by cardinality then catalog order
+     */
+    ScaleIndexRange withCardinality(int minNotes, int maxNotes) const {
+        minNotes = max(minNotes, 0);
+        maxNotes = min(maxNotes, MOD);
+        if (minNotes > maxNotes) return {byCardinality_, byCardinality_};
+        return {byCardinality_ + cardinalityStart_[minNotes], byCardinality_ + cardinalityStart_[maxNotes + 1]};
+    }
+};
+
+// ==================== FILE I/O ====================
+
+/**
+ * @brief Writes a packed catalog image to a file
+ * @param path Output file
+ * @param catalog Catalog to write
+ * @throw runtime_error If the file cannot be written
+ */
+void writeScaleCatalog(const string& path, const PackedScaleCatalog& catalog) {
+    ofstream out(path, ios::binary);
+    out.write(static_cast<const char*>(catalog.data()), static_cast<streamsize>(catalog.byteSize()));
+    if (!out) {
+        throw runtime_error("Cannot write scale catalog to " + path);
+    }
+}
+
+/**
+ * @brief Reads a packed catalog image from a file
+ * @param path Input file
+ * @return Image words, to be viewed with PackedScaleCatalog
+ * @throw runtime_error If the file cannot be read
+ */
+vector<uint32_t> readScaleCatalog(const string& path) {
+    ifstream in(path, ios::binary | ios::ate);
+    if (!in) {
+        throw runtime_error("Cannot read scale catalog from " + path);
+    }
+    streamsize bytes = in.tellg();
+    vector<uint32_t> image((static_cast<size_t>(bytes) + 3) / 4, 0);
+    in.seekg(0);
+    if (!in.read(reinterpret_cast<char*>(image.data()), bytes)) {
+        throw runtime_error("Cannot read scale catalog from " + path);
+    }
+    return image;
+}
+
+#endif // SCALE_CATALOG_H
@@ -41,12 +41,11 @@
      * @note Musical applications: basso continuo realization, harmonic analysis,
      *       scale degree extraction
      */
-    PositionVector select(const PositionVector& source, 
+    PositionVector select(const PositionVectorView& source, 
                          const PositionVector& criterion,
                          int criterionRotation = 0, int voices = 0) {
         // Apply rototranslation if needed
-        vector<int> sourceData = source.getData();
-        int criterionModulo = static_cast<int>(sourceData.size());
+        int criterionModulo = static_cast<int>(source.size());
         PositionVector actualCriterion(criterion.getData(), criterionModulo);
         actualCriterion.setMod(source.size());
         PositionVector rotatedCriterion = (criterionRotation != 0) 
@@ -55,7 +54,7 @@
         
         // Determine output length
         int outLength = (voices > 0) ? voices : static_cast<int>(rotatedCriterion.size());
-        vector<int> result(outLength);
+        VectorData result(outLength);
         
         // Use cyclic access for both vectors
         for (int k = 0; k < outLength; ++k) {
@@ -84,7 +83,7 @@
      * @note Musical applications: harmony by intervals, voice leading analysis,
      *       chord construction following intervallic patterns
      */
-    PositionVector select(const PositionVector& source,
+    PositionVector select(const PositionVectorView& source,
                          const IntervalVector& criterion,
                          int criterionRotation = 0, int voices = 0) {
         // Apply rotation if needed
@@ -96,7 +95,7 @@
         
         // Determine output length
         int outLength = (voices > 0) ? voices : static_cast<int>(rotatedCriterion.size());
-        vector<int> result(outLength);
+        VectorData result(outLength);
         
         int cumulativePosition = rotatedCriterion.getOffset();
         
@@ -132,7 +131,7 @@
      * @note Musical applications: extended harmony construction (9th, 11th, 13th chords),
      *       compound interval formation
      */
-    IntervalVector select(const IntervalVector& source,
+    IntervalVector select(const IntervalVectorView& source,
                          const IntervalVector& indices,
                          int criterionRotation = 0, int voices = 0) {
         // Apply rotation if needed
@@ -153,7 +152,7 @@
         
         // Determine output length
         int outLength = (voices > 0) ? voices : static_cast<int>(rotatedCriterion.size());
-        vector<int> result(outLength);
+        VectorData result(outLength);
         
         int cumulativeIndex = criterionOffset;
         
@@ -194,12 +193,10 @@
      * @note Musical applications: basso continuo from intervals, chord extraction,
      *       direct interval relationships
      */
-    IntervalVector select(const IntervalVector& source,
+    IntervalVector select(const IntervalVectorView& source,
                          const PositionVector& criterion,
                          int criterionRotation = 0, int voices = 0) {
-        vector<int> sourceData = source.getData();
         int off = source.getOffset();
-        int criterionModulo = static_cast<int>(sourceData.size());
         PositionVector actualCriterion = criterion;
         actualCriterion.setMod(source.size());
         PositionVector rotatedCriterion = (criterionRotation != 0) 
@@ -212,7 +209,7 @@
 
 
         int outLength = (voices > 0) ? voices : static_cast<int>(rotatedCriterion.size());
-        vector<int> result(outLength);
+        VectorData result(outLength);
         int n = static_cast<int>(source.size());
         
 
@@ -248,4 +245,30 @@
         return IntervalVector(result, sOut, source.getMod());
     }
 
+    // ==================== OWNING SOURCES ====================
+
+    /**
+     * @brief Selections from an owning vector
+     * @details Forward to the view overloads above, the source data is not copied.
+     */
+    PositionVector select(const PositionVector& source, const PositionVector& criterion,
+                          int criterionRotation = 0, int voices = 0) {
+        return select(PositionVectorView(source), criterion, criterionRotation, voices);
+    }
+
+    PositionVector select(const PositionVector& source, const IntervalVector& criterion,
+                          int criterionRotation = 0, int voices = 0) {
+        return select(PositionVectorView(source), criterion, criterionRotation, voices);
+    }
+
+    IntervalVector select(const IntervalVector& source, const IntervalVector& indices,
+                          int criterionRotation = 0, int voices = 0) {
+        return select(IntervalVectorView(source), indices, criterionRotation, voices);
+    }
+
+    IntervalVector select(const IntervalVector& source, const PositionVector& criterion,
+                          int criterionRotation = 0, int voices = 0) {
+        return select(IntervalVectorView(source), criterion, criterionRotation, voices);
+    }
+
 #endif // SELECTION_H
@@ -0,0 +1,271 @@
+#ifndef SET_CLASS_H
+#define SET_CLASS_H
+
+#include "./vectors.h"
+
+/**
+ * @file setClass.h
+ * @brief Normal form, prime forms and set-class identifiers of pitch-class sets
+ * @author [not251]
+ * @date 2025
+ * @details Every computation works on the bitmask of the set (see pitchClassMask.h).
+ *          Reading a mask as an integer, its highest bit is the last pitch class of the
+ *          ordering that starts at 0. Among the rotations of the mask, the smallest one is
+ *          therefore the transposition of the set that is most packed to the left in
+ *          Rahn's sense: smallest span first, then smallest distance between the first
+ *          and the next-to-last pitch class, and so on. The normal order, the Tn prime
+ *          form and the TnI prime form all follow from a single minimization over the
+ *          rotations of the set and of its inversion, with no sorting.
+ *
+ *          Prime forms follow Rahn's convention (as in most current software). Forte's
+ *          tables differ for a few classes, e.g. 5-20, 6-Z29, 6-31, 7-Z18, 7-20, 8-26.
+ *
+ *          For mod 12 all 4096 sets are classified once, on first use, into a shared
+ *          read-only table. Other moduli up to 64 are classified on demand and cached
+ *          per SetClassEngine.
+ */
+
+/**
+ * @brief Classification of one pitch-class set
+ */
+struct SetClass {
+    uint64_t tnPrime;   ///< Prime form under transposition, bit i set for pitch class i
+    uint64_t tniPrime;  ///< Prime form under transposition and inversion
+    int normalStart;    ///< First pitch class of the normal order (0 for the empty set)
+    bool inverted;      ///< True if tniPrime is a transposition of the inverted set only
+    bool chiral;        ///< True if the set is not a transposition of its own inversion
+    int mod;            ///< Modulus of the set
+};
+
+/**
+ * @class SetClassEngine
+ * @brief Set-class queries for PositionVector and BinaryVector with a lookup table for
+ *        mod 12 and a per-modulus cache for the other moduli
+ * @note An engine is not thread-safe. The free functions below use one engine per thread.
+ */
+class SetClassEngine {
+private:
+    /**
+     * @brief Packed table entry for mod 12
+     */
+    struct Entry12 {
+        uint16_t tnPrime;
+        uint16_t tniPrime;
+        uint8_t normalStart;
+        bool inverted;
+        bool chiral;
+    };
+
+    vector<unordered_map<uint64_t, SetClass>> caches_; ///< Index mod, keyed by set bits
+
+    /**
+     * @brief Smallest rotation of a mask and the shift that brings the set down to it
+     * @details The shift is the smallest one reaching the minimum, so symmetric sets
+     *          start their normal order on their lowest candidate pitch class.
+     */
+    static pair<uint64_t, int> minimalRotation(uint64_t bits, int mod) {
+        size_t width = static_cast<size_t>(mod);
+        uint64_t best = bits;
+        int start = 0;
+        for (int k = 1; k < mod; ++k) {
+            // Rotating up by mod - k transposes the set down by k
+            uint64_t rotated = rotateBitsLeft(bits, width - static_cast<size_t>(k), width);
+            if (rotated < best) {
+                best = rotated;
+                start = k;
+            }
+        }
+        return {best, start};
+    }
+
+    static const vector<Entry12>& table12() {
+        static const vector<Entry12> table = [] {
+            vector<Entry12> entries(4096);
+            for (uint64_t bits = 0; bits < 4096; ++bits) {
+                SetClass sc = compute(bits, 12);
+                entries[bits] = {static_cast<uint16_t>(sc.tnPrime), static_cast<uint16_t>(sc.tniPrime),
+                                 static_cast<uint8_t>(sc.normalStart), sc.inverted, sc.chiral};
+            }
+            return entries;
+        }();
+        return table;
+    }
+
+    static PositionVector maskVector(uint64_t bits, int mod) {
+        return maskToPositions(PitchClassMask::fromBits(bits, mod));
+    }
+
+public:
+    SetClassEngine() : caches_(static_cast<size_t>(PitchClassMask::MAX_MOD) + 1) {}
+
+    /**
+     * @brief Classifies a set without any table or cache
+     * @param bits Set bits, bit i for pitch class i (bits at or above mod must be zero)
+     * @param mod Modulus in [1, 64]
+     * @return Normal order start and prime forms of the set
+     */
+    static SetClass compute(uint64_t bits, int mod) {
+        pair<uint64_t, int> tn = minimalRotation(bits, mod);
+        // Bit reversal maps p to mod - 1 - p, an inversion up to transposition
+        uint64_t reversed = reverseBits64(bits) >> (WORD_BITS - static_cast<size_t>(mod));
+        uint64_t invertedPrime = minimalRotation(reversed, mod).first;
+        bool inverted = invertedPrime < tn.first;
+        bool chiral = invertedPrime != tn.first;
+        return {tn.first, inverted ? invertedPrime : tn.first, tn.second, inverted, chiral, mod};
+    }
+
+    // ==================== CLASSIFICATION ====================
+
+    /**
+     * @brief Classifies a pitch-class set
+     * @param set Any set with modulus up to 64
+     * @return Table entry for mod 12, cached result otherwise
+     */
+    SetClass classify(const PitchClassMask& set) {
+        int mod = set.getMod();
+        uint64_t bits = set.getBits();
+        if (mod == 12) {
+            const Entry12& entry = table12()[bits];
+            return {entry.tnPrime, entry.tniPrime, entry.normalStart, entry.inverted, entry.chiral, 12};
+        }
+        unordered_map<uint64_t, SetClass>& cache = caches_[static_cast<size_t>(mod)];
+        auto it = cache.find(bits);
+        if (it == cache.end()) {
+            it = cache.emplace(bits, compute(bits, mod)).first;
+        }
+        return it->second;
+    }
+
+    /**
+     * @brief Classifies the pitch classes of a PositionVector
+     * @throw invalid_argument If the modulus is outside [1, 64]
+     */
+    SetClass classify(const PositionVector& positions) {
+        return classify(positionsToMask(positions));
+    }
+
+    /**
+     * @brief Classifies the onsets of a BinaryVector, modulo its length
+     * @throw invalid_argument If the length is outside [1, 64]
+     */
+    SetClass classify(const BinaryVector& binary) {
+        return classify(binaryToMask(binary));
+    }
+
+    // ==================== FORMS ====================
+
+    /**
+     * @brief Normal order of a set
+     * @param positions Source positions, reduced modulo their mod
+     * @return Ascending positions starting at the first pitch class of the normal order
+     *         and spanning less than mod, e.g. {11, 12, 16} for {0, 4, 11}
+     */
+    PositionVector normalForm(const PositionVector& positions) {
+        SetClass sc = classify(positions);
+        VectorData data = PitchClassMask::fromBits(sc.tnPrime, sc.mod).toData();
+        for (int& value : data) {
+            value += sc.normalStart;
+        }
+        return PositionVector(data, sc.mod);
+    }
+
+    PositionVector normalForm(const BinaryVector& binary) {
+        return normalForm(maskToPositions(binaryToMask(binary)));
+    }
+
+    /**
+     * @brief Prime form of a set
+     * @param positions Source positions, reduced modulo their mod
+     * @param inversion If true the TnI prime form, otherwise the Tn prime form
+     * @return Pitch classes of the prime form in ascending order, starting at 0
+     */
+    PositionVector primeForm(const PositionVector& positions, bool inversion = true) {
+        SetClass sc = classify(positions);
+        return maskVector(inversion ? sc.tniPrime : sc.tnPrime, sc.mod);
+    }
+
+    PositionVector primeForm(const BinaryVector& binary, bool inversion = true) {
+        SetClass sc = classify(binary);
+        return maskVector(inversion ? sc.tniPrime : sc.tnPrime, sc.mod);
+    }
+
+    /**
+     * @brief Stable identifier of the set class
+     * @param positions Source positions, reduced modulo their mod
+     * @param inversion If true the TnI class, otherwise the Tn class
+     * @return Bits of the prime form: equal for two sets of the same modulus exactly when
+     *         they belong to the same class, and independent of the engine and of the run
+     */
+    uint64_t setClassId(const PositionVector& positions, bool inversion = true) {
+        SetClass sc = classify(positions);
+        return inversion ? sc.tniPrime : sc.tnPrime;
+    }
+
+    uint64_t setClassId(const BinaryVector& binary, bool inversion = true) {
+        SetClass sc = classify(binary);
+        return inversion ? sc.tniPrime : sc.tnPrime;
+    }
+
+    // ==================== CACHE ====================
+
+    /**
+     * @brief Number of cached sets (the mod 12 table is not counted)
+     */
+    size_t cachedSets() const {
+        size_t total = 0;
+        for (const auto& cache : caches_) {
+            total += cache.size();
+        }
+        return total;
+    }
+
+    void clearCache() {
+        for (auto& cache : caches_) {
+            cache.clear();
+        }
+    }
+};
+
+// ==================== FREE FUNCTIONS ====================
+
+/**
+ * @brief Engine of the calling thread, used by the free functions below
+ */
+inline SetClassEngine& setClassEngine() {
+    thread_local SetClassEngine engine;
+    return engine;
+}
+
+inline SetClass classifySet(const PositionVector& positions) {
+    return setClassEngine().classify(positions);
+}
+
+inline SetClass classifySet(const BinaryVector& binary) {
+    return setClassEngine().classify(binary);
+}
+
+inline PositionVector normalForm(const PositionVector& positions) {
+    return setClassEngine().normalForm(positions);
+}
+
+inline PositionVector normalForm(const BinaryVector& binary) {
+    return setClassEngine().normalForm(binary);
+}
+
+inline PositionVector primeForm(const PositionVector& positions, bool inversion = true) {
+    return setClassEngine().primeForm(positions, inversion);
+}
+
+inline PositionVector primeForm(const BinaryVector& binary, bool inversion = true) {
+    return setClassEngine().primeForm(binary, inversion);
+}
+
+inline uint64_t setClassId(const PositionVector& positions, bool inversion = true) {
+    return setClassEngine().setClassId(positions, inversion);
+}
+
+inline uint64_t setClassId(const BinaryVector& binary, bool inversion = true) {
+    return setClassEngine().setClassId(binary, inversion);
+}
+
+#endif // SET_CLASS_H
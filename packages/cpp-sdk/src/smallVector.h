@@ -0,0 +1,312 @@
+#ifndef SMALLVECTOR_H
+#define SMALLVECTOR_H
+
+#include "./utility.h"
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+
+/**
+ * @file smallVector.h
+ * @brief Vector-like container with inline storage for short sequences
+ * @author [not251]
+ * @date 2025
+ * @details SmallVector keeps up to N elements inside the object and only moves to
+ *          the heap when it grows past that. Chords and scales rarely exceed a
+ *          dozen notes, so PositionVector and IntervalVector use it to avoid an
+ *          allocation per operation. It converts to and from std::vector so
+ *          existing code that works with vector<int> keeps compiling.
+ */
+
+/**
+ * @class SmallVector
+ * @brief Contiguous sequence with N inline slots and heap fallback
+ * @tparam T Element type (must be trivially copyable)
+ * @tparam N Number of elements stored inline
+ */
+template<typename T, size_t N>
+class SmallVector {
+    static_assert(is_trivially_copyable<T>::value, "SmallVector requires a trivially copyable type");
+
+private:
+    T* ptr_;
+    size_t size_;
+    size_t capacity_;
+    T inline_[N];
+
+    bool isInline() const { return ptr_ == inline_; }
+
+    /**
+     * @brief Moves the contents to a buffer of at least the requested capacity
+     * @param newCapacity Required capacity
+     */
+    void grow(size_t newCapacity) {
+        if (newCapacity <= capacity_) return;
+        newCapacity = max(newCapacity, capacity_ * 2);
+        T* buffer = new T[newCapacity];
+        if (size_ > 0) memcpy(buffer, ptr_, size_ * sizeof(T));
+        if (!isInline()) delete[] ptr_;
+        ptr_ = buffer;
+        capacity_ = newCapacity;
+    }
+
+    void release() {
+        if (!isInline()) delete[] ptr_;
+        ptr_ = inline_;
+        capacity_ = N;
+        size_ = 0;
+    }
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    // ==================== CONSTRUCTORS ====================
+
+    SmallVector() : ptr_(inline_), size_(0), capacity_(N) {}
+
+    explicit SmallVector(size_t count, const T& value = T()) : SmallVector() {
+        assign(count, value);
+    }
+
+    SmallVector(initializer_list<T> values) : SmallVector() {
+        assign(values.begin(), values.end());
+    }
+
+    template<typename InputIt,
+             typename = enable_if_t<!is_integral<InputIt>::value>>
+    SmallVector(InputIt first, InputIt last) : SmallVector() {
+        assign(first, last);
+    }
+
+    SmallVector(const vector<T>& values) : SmallVector() {
+        assign(values.begin(), values.end());
+    }
+
+    SmallVector(const SmallVector& other) : SmallVector() {
+        assign(other.begin(), other.end());
+    }
+
+    SmallVector(SmallVector&& other) noexcept : SmallVector() {
+        *this = move(other);
+    }
+
+    ~SmallVector() {
+        if (!isInline()) delete[] ptr_;
+    }
+
+    SmallVector& operator=(const SmallVector& other) {
+        if (this != &other) {
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& other) noexcept {
+        if (this == &other) return *this;
+        if (other.isInline()) {
+            // Inline contents cannot be stolen, copy them instead
+            size_ = 0;
+            if (other.size_ > 0) memcpy(ptr_, other.ptr_, other.size_ * sizeof(T));
+            size_ = other.size_;
+        } else {
+            release();
+            ptr_ = other.ptr_;
+            size_ = other.size_;
+            capacity_ = other.capacity_;
+            other.ptr_ = other.inline_;
+            other.capacity_ = N;
+        }
+        other.size_ = 0;
+        return *this;
+    }
+
+    SmallVector& operator=(initializer_list<T> values) {
+        assign(values.begin(), values.end());
+        return *this;
+    }
+
+    /**
+     * @brief Converts to a std::vector copy
+     */
+    operator vector<T>() const {
+        return vector<T>(begin(), end());
+    }
+
+    // ==================== ASSIGNMENT ====================
+
+    void assign(size_t count, const T& value) {
+        T copy = value;   // value may live in this container
+        size_ = 0;
+        grow(count);
+        fill(ptr_, ptr_ + count, copy);
+        size_ = count;
+    }
+
+    template<typename InputIt,
+             typename = enable_if_t<!is_integral<InputIt>::value>>
+    void assign(InputIt first, InputIt last) {
+        size_ = 0;
+        size_t count = static_cast<size_t>(distance(first, last));
+        grow(count);
+        copy(first, last, ptr_);
+        size_ = count;
+    }
+
+    // ==================== ACCESS ====================
+
+    T& operator[](size_t i) { return ptr_[i]; }
+    const T& operator[](size_t i) const { return ptr_[i]; }
+
+    T& at(size_t i) {
+        if (i >= size_) throw out_of_range("SmallVector index out of range");
+        return ptr_[i];
+    }
+    const T& at(size_t i) const {
+        if (i >= size_) throw out_of_range("SmallVector index out of range");
+        return ptr_[i];
+    }
+
+    T& front() { return ptr_[0]; }
+    const T& front() const { return ptr_[0]; }
+    T& back() { return ptr_[size_ - 1]; }
+    const T& back() const { return ptr_[size_ - 1]; }
+
+    T* data() { return ptr_; }
+    const T* data() const { return ptr_; }
+
+    // ==================== ITERATORS ====================
+
+    iterator begin() { return ptr_; }
+    iterator end() { return ptr_ + size_; }
+    const_iterator begin() const { return ptr_; }
+    const_iterator end() const { return ptr_ + size_; }
+    const_iterator cbegin() const { return ptr_; }
+    const_iterator cend() const { return ptr_ + size_; }
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    // ==================== CAPACITY ====================
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    size_t capacity() const { return capacity_; }
+
+    void reserve(size_t newCapacity) { grow(newCapacity); }
+
+    void shrink_to_fit() {}
+
+    // ==================== MODIFIERS ====================
+
+    void clear() { size_ = 0; }
+
+    void push_back(const T& value) {
+        T copy = value;   // value may live in the buffer grow() frees
+        if (size_ == capacity_) grow(size_ + 1);
+        ptr_[size_++] = copy;
+    }
+
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        T value(forward<Args>(args)...);
+        push_back(value);
+        return back();
+    }
+
+    void pop_back() { --size_; }
+
+    void resize(size_t count, const T& value = T()) {
+        if (count > size_) {
+            T copy = value;
+            grow(count);
+            fill(ptr_ + size_, ptr_ + count, copy);
+        }
+        size_ = count;
+    }
+
+    iterator insert(const_iterator pos, const T& value) {
+        return insert(pos, size_t(1), value);
+    }
+
+    iterator insert(const_iterator pos, size_t count, const T& value) {
+        size_t index = static_cast<size_t>(pos - ptr_);
+        // value may live in this container, where grow() frees it or memmove shifts it
+        T copy = value;
+        grow(size_ + count);
+        memmove(ptr_ + index + count, ptr_ + index, (size_ - index) * sizeof(T));
+        fill(ptr_ + index, ptr_ + index + count, copy);
+        size_ += count;
+        return ptr_ + index;
+    }
+
+    template<typename InputIt,
+             typename = enable_if_t<!is_integral<InputIt>::value>>
+    iterator insert(const_iterator pos, InputIt first, InputIt last) {
+        size_t index = static_cast<size_t>(pos - ptr_);
+        size_t count = static_cast<size_t>(distance(first, last));
+        if (count == 0) return ptr_ + index;
+        // The source range may alias this container, so copy it out first when it does
+        SmallVector staged(first, last);
+        grow(size_ + count);
+        memmove(ptr_ + index + count, ptr_ + index, (size_ - index) * sizeof(T));
+        memcpy(ptr_ + index, staged.ptr_, count * sizeof(T));
+        size_ += count;
+        return ptr_ + index;
+    }
+
+    iterator insert(const_iterator pos, initializer_list<T> values) {
+        return insert(pos, values.begin(), values.end());
+    }
+
+    iterator erase(const_iterator pos) {
+        return erase(pos, pos + 1);
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        size_t index = static_cast<size_t>(first - ptr_);
+        size_t count = static_cast<size_t>(last - first);
+        memmove(ptr_ + index, ptr_ + index + count, (size_ - index - count) * sizeof(T));
+        size_ -= count;
+        return ptr_ + index;
+    }
+
+    void swap(SmallVector& other) {
+        SmallVector tmp(move(other));
+        other = move(*this);
+        *this = move(tmp);
+    }
+
+    // ==================== COMPARISON ====================
+
+    friend bool operator==(const SmallVector& a, const SmallVector& b) {
+        return a.size_ == b.size_ && equal(a.begin(), a.end(), b.begin());
+    }
+
+    friend bool operator!=(const SmallVector& a, const SmallVector& b) {
+        return !(a == b);
+    }
+
+    friend bool operator<(const SmallVector& a, const SmallVector& b) {
+        return lexicographical_compare(a.begin(), a.end(), b.begin(), b.end());
+    }
+};
+
+/**
+ * @brief Storage used by PositionVector and IntervalVector
+ * @details 16 inline slots cover chords, scales and most rhythms without heap allocation.
+ */
+using VectorData = SmallVector<int, 16>;
+
+#endif // SMALLVECTOR_H
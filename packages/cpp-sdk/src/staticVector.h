@@ -0,0 +1,371 @@
+#ifndef STATICVECTOR_H
+#define STATICVECTOR_H
+
+#include "./positionVector.h"
+#include "./intervalVector.h"
+#include <array>
+
+/**
+ * @file staticVector.h
+ * @brief Fixed-size, constexpr-capable position and interval vectors
+ * @author [not251]
+ * @date 2025
+ * @details StaticPositionVector and StaticIntervalVector store their elements in a
+ *          std::array whose length and modulus are template parameters. Shapes known
+ *          in advance (triads, tetrads, 7-note scales in 12-TET) get fully unrolled,
+ *          allocation-free code, and tables such as the modes of a scale or its
+ *          diatonic harmonization can be computed at compile time:
+ *
+ *          @code
+ *          constexpr StaticIntervalVector<7> major({2, 2, 1, 2, 2, 2, 1});
+ *          constexpr auto modes = modeTable(major);            // 7 positional modes
+ *          constexpr auto triads = harmonize<3>(modes[0]);     // I, ii, iii, ...
+ *          static_assert(triads[4][2] == 14, "V chord fifth is D");
+ *          @endcode
+ *
+ *          Both types convert to and from PositionVector / IntervalVector so they can
+ *          be passed to the rest of the library.
+ */
+
+template<size_t N, int Mod> class StaticIntervalVector;
+
+/**
+ * @class StaticPositionVector
+ * @brief Position vector with compile-time length and modulus
+ * @tparam N Number of elements
+ * @tparam Mod Modulus (cyclic period), default 12
+ *
+ * @details Mirrors PositionVector with automatic range updating: the range is the
+ *          smallest multiple of Mod containing the span of the data, and cyclic access
+ *          adds one range per wrap.
+ */
+template<size_t N, int Mod = 12>
+class StaticPositionVector {
+    static_assert(Mod > 0, "StaticPositionVector requires a positive modulus");
+
+public:
+    array<int, N> data;     ///< Vector data
+
+    // ==================== CONSTRUCTORS ====================
+
+    constexpr StaticPositionVector() : data{} {}
+
+    /**
+     * @brief Constructs from a fixed-size array
+     * @param values Initial data
+     */
+    constexpr StaticPositionVector(const array<int, N>& values) : data(values) {}
+
+    /**
+     * @brief Constructs from a dynamic PositionVector
+     * @param pv Source vector
+     * @throw invalid_argument If size or modulus differ from N and Mod
+     */
+    explicit StaticPositionVector(const PositionVector& pv) : data{} {
+        if (pv.data.size() != N || pv.mod != Mod) {
+            throw invalid_argument("PositionVector does not match StaticPositionVector shape");
+        }
+        for (size_t i = 0; i < N; ++i) {
+            data[i] = pv.data[i];
+        }
+    }
+
+    /**
+     * @brief Converts to a dynamic PositionVector
+     */
+    PositionVector toPositionVector() const {
+        return PositionVector(VectorData(data.begin(), data.end()), Mod);
+    }
+
+    operator PositionVector() const { return toPositionVector(); }
+
+    // ==================== ACCESS ====================
+
+    static constexpr size_t size() { return N; }
+    static constexpr int mod() { return Mod; }
+
+    /**
+     * @brief Smallest multiple of Mod containing the data span
+     * @return Effective range used for cyclic access
+     */
+    constexpr int range() const {
+        if (N == 0) return Mod;
+        int maxValue = data[0];
+        int minValue = data[0];
+        for (size_t i = 1; i < N; ++i) {
+            if (data[i] > maxValue) maxValue = data[i];
+            if (data[i] < minValue) minValue = data[i];
+        }
+        return Mod * (euclideanDivision(maxValue - minValue, Mod).quotient + 1);
+    }
+
+    /**
+     * @brief Cyclic access, adding one range per complete cycle
+     * @param index Any integer index
+     * @return Element value, 0 if the vector is empty
+     */
+    constexpr int element(int index) const {
+        if (N == 0) return 0;
+        int size = static_cast<int>(N);
+        DivisionResult div = euclideanDivision(index, size);
+        return data[div.remainder] + range() * div.quotient;
+    }
+
+    constexpr int operator[](int index) const { return element(index); }
+
+    constexpr bool operator==(const StaticPositionVector& other) const {
+        for (size_t i = 0; i < N; ++i) {
+            if (data[i] != other.data[i]) return false;
+        }
+        return true;
+    }
+
+    constexpr bool operator!=(const StaticPositionVector& other) const {
+        return !(*this == other);
+    }
+
+    // ==================== TRANSFORMATIONS ====================
+
+    /**
+     * @brief Transposition by a scalar
+     */
+    constexpr StaticPositionVector operator+(int scalar) const {
+        StaticPositionVector result;
+        for (size_t i = 0; i < N; ++i) {
+            result.data[i] = data[i] + scalar;
+        }
+        return result;
+    }
+
+    constexpr StaticPositionVector operator-(int scalar) const {
+        return *this + (-scalar);
+    }
+
+    /**
+     * @brief Circular shift of the elements, as PositionVector::rotate
+     * @param rotationAmount Rotation amount (sign is ignored)
+     */
+    constexpr StaticPositionVector rotate(int rotationAmount) const {
+        StaticPositionVector result;
+        if (N == 0) return result;
+        size_t shift = static_cast<size_t>(rotationAmount < 0 ? -rotationAmount : rotationAmount) % N;
+        for (size_t i = 0; i < N; ++i) {
+            result.data[(i + shift) % N] = data[i];
+        }
+        return result;
+    }
+
+    /**
+     * @brief Extracts M consecutive elements with cyclic access, as PositionVector::rotoTranslate
+     * @tparam M Output length (default N)
+     * @param startOffset Starting index
+     */
+    template<size_t M = N>
+    constexpr StaticPositionVector<M, Mod> rotoTranslate(int startOffset) const {
+        StaticPositionVector<M, Mod> result;
+        for (size_t i = 0; i < M; ++i) {
+            result.data[i] = element(startOffset + static_cast<int>(i));
+        }
+        return result;
+    }
+
+    /**
+     * @brief Position-based selection, as Selection::select(PositionVector, PositionVector)
+     * @tparam K Number of selected voices
+     * @param degrees Indices into this vector (cyclic)
+     */
+    template<size_t K>
+    constexpr StaticPositionVector<K, Mod> select(const array<int, K>& degrees) const {
+        StaticPositionVector<K, Mod> result;
+        for (size_t k = 0; k < K; ++k) {
+            result.data[k] = element(degrees[k]);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Converts to intervals, as positionsToIntervals
+     * @return Intervals between consecutive (cyclic) positions, offset = first element
+     */
+    constexpr StaticIntervalVector<N, Mod> toIntervals() const;
+};
+
+/**
+ * @class StaticIntervalVector
+ * @brief Interval vector with compile-time length and modulus
+ * @tparam N Number of intervals
+ * @tparam Mod Modulus, default 12
+ */
+template<size_t N, int Mod = 12>
+class StaticIntervalVector {
+    static_assert(Mod > 0, "StaticIntervalVector requires a positive modulus");
+
+public:
+    array<int, N> data;     ///< Interval data
+    int offset;             ///< Offset for translations
+
+    // ==================== CONSTRUCTORS ====================
+
+    constexpr StaticIntervalVector() : data{}, offset(0) {}
+
+    /**
+     * @brief Constructs from a fixed-size array
+     * @param values Intervals
+     * @param newOffset Initial offset, default 0
+     */
+    constexpr StaticIntervalVector(const array<int, N>& values, int newOffset = 0)
+        : data(values), offset(newOffset) {}
+
+    /**
+     * @brief Constructs from a dynamic IntervalVector
+     * @param iv Source vector
+     * @throw invalid_argument If size or modulus differ from N and Mod
+     */
+    explicit StaticIntervalVector(const IntervalVector& iv) : data{}, offset(iv.offset) {
+        if (iv.data.size() != N || iv.mod != Mod) {
+            throw invalid_argument("IntervalVector does not match StaticIntervalVector shape");
+        }
+        for (size_t i = 0; i < N; ++i) {
+            data[i] = iv.data[i];
+        }
+    }
+
+    /**
+     * @brief Converts to a dynamic IntervalVector
+     */
+    IntervalVector toIntervalVector() const {
+        return IntervalVector(VectorData(data.begin(), data.end()), offset, Mod);
+    }
+
+    operator IntervalVector() const { return toIntervalVector(); }
+
+    // ==================== ACCESS ====================
+
+    static constexpr size_t size() { return N; }
+    static constexpr int mod() { return Mod; }
+
+    /**
+     * @brief Cyclic access
+     * @param i Any integer index
+     * @return Interval value, 0 if the vector is empty
+     */
+    constexpr int element(int i) const {
+        if (N == 0) return 0;
+        return data[euclideanDivision(i, static_cast<int>(N)).remainder];
+    }
+
+    constexpr int operator[](int i) const { return element(i); }
+
+    constexpr bool operator==(const StaticIntervalVector& other) const {
+        for (size_t i = 0; i < N; ++i) {
+            if (data[i] != other.data[i]) return false;
+        }
+        return offset == other.offset;
+    }
+
+    constexpr bool operator!=(const StaticIntervalVector& other) const {
+        return !(*this == other);
+    }
+
+    /**
+     * @brief Sum of all intervals
+     */
+    constexpr int sum() const {
+        int total = 0;
+        for (size_t i = 0; i < N; ++i) {
+            total += data[i];
+        }
+        return total;
+    }
+
+    // ==================== TRANSFORMATIONS ====================
+
+    /**
+     * @brief Returns a copy with a new offset
+     * @param newOffset Offset to set
+     */
+    constexpr StaticIntervalVector withOffset(int newOffset) const {
+        return StaticIntervalVector(data, newOffset);
+    }
+
+    /**
+     * @brief Rotation, as IntervalVector::rotate (offset is kept)
+     * @param r Rotation amount
+     */
+    constexpr StaticIntervalVector rotate(int r) const {
+        StaticIntervalVector result(data, offset);
+        for (size_t i = 0; i < N; ++i) {
+            result.data[i] = element(r + static_cast<int>(i));
+        }
+        return result;
+    }
+
+    /**
+     * @brief Converts to positions, as intervalsToPositions
+     * @return Positions starting at offset and accumulating the first N-1 intervals
+     */
+    constexpr StaticPositionVector<N, Mod> toPositions() const {
+        StaticPositionVector<N, Mod> result;
+        int currentPos = offset;
+        for (size_t i = 0; i < N; ++i) {
+            result.data[i] = currentPos;
+            currentPos += data[i];
+        }
+        return result;
+    }
+};
+
+template<size_t N, int Mod>
+constexpr StaticIntervalVector<N, Mod> StaticPositionVector<N, Mod>::toIntervals() const {
+    StaticIntervalVector<N, Mod> result;
+    if (N == 0) return result;
+    result.offset = data[0];
+    if (N > 1) {
+        for (size_t i = 0; i < N; ++i) {
+            result.data[i] = element(static_cast<int>(i) + 1) - data[i];
+        }
+    }
+    return result;
+}
+
+// ==================== COMPILE-TIME TABLES ====================
+
+/**
+ * @brief All modes of a scale in positional form
+ * @param generator Scale intervals
+ * @param root Root of every mode, default 0
+ * @return Table where entry m equals Scale(generator, root, m).toPositions()
+ */
+template<size_t N, int Mod>
+constexpr array<StaticPositionVector<N, Mod>, N> modeTable(const StaticIntervalVector<N, Mod>& generator,
+                                                           int root = 0) {
+    array<StaticPositionVector<N, Mod>, N> table{};
+    StaticIntervalVector<N, Mod> rooted = generator.withOffset(root);
+    for (size_t m = 0; m < N; ++m) {
+        table[m] = rooted.rotate(static_cast<int>(m)).toPositions();
+    }
+    return table;
+}
+
+/**
+ * @brief Chords built on every degree of a scale by stacking scale steps
+ * @tparam K Number of voices per chord (3 = triads, 4 = seventh chords)
+ * @param scale Scale in positional form
+ * @param step Degrees between consecutive voices, default 2 (tertian harmony)
+ * @return Table where entry d equals select(scale, {d, d + step, ..., d + (K-1)*step})
+ */
+template<size_t K, size_t N, int Mod>
+constexpr array<StaticPositionVector<K, Mod>, N> harmonize(const StaticPositionVector<N, Mod>& scale,
+                                                           int step = 2) {
+    array<StaticPositionVector<K, Mod>, N> table{};
+    for (size_t d = 0; d < N; ++d) {
+        array<int, K> degrees{};
+        for (size_t k = 0; k < K; ++k) {
+            degrees[k] = static_cast<int>(d) + static_cast<int>(k) * step;
+        }
+        table[d] = scale.select(degrees);
+    }
+    return table;
+}
+
+#endif // STATICVECTOR_H
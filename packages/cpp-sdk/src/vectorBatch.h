@@ -0,0 +1,725 @@
+#ifndef VECTOR_BATCH_H
+#define VECTOR_BATCH_H
+
+#include "./distances.h"
+
+/**
+ * @file vectorBatch.h
+ * @brief Contiguous containers for many PositionVectors or IntervalVectors of equal length
+ * @author [not251]
+ * @date 2025
+ * @details A batch stores N rows of K values in one N*K block, row after row, with the
+ *          metadata shared by all rows stored once. Only what differs between rows is kept
+ *          per row: the effective range for positions, the offset for intervals.
+ *
+ *          Batch operations give the same rows as the member functions (and the select
+ *          functions of selection.h) applied to each row. Since every row has the same
+ *          length, the cyclic indices of an operation are resolved once and each row only
+ *          reads its values through them. Distances use the batch kernels of
+ *          batchDistance.h directly on the block when the policy has one. Rows are
+ *          available as views (vectorView.h) that select, chord, quantize and the distance
+ *          functions read in place.
+ */
+
+// ==================== POSITION VECTOR BATCH ====================
+
+/**
+ * @class PositionVectorBatch
+ * @brief N PositionVectors of length K in one contiguous block
+ * @details mod, userRange, rangeUpdate and user are shared. The range is stored per row,
+ *          as it depends on the span of each row when rangeUpdate is true.
+ */
+class PositionVectorBatch {
+public:
+    /**
+     * @brief Non-owning view of one row, valid until the batch is modified
+     */
+    using Row = PositionVectorView;
+
+private:
+    vector<int> values_;  ///< Row-major values, row i at i * length_
+    vector<int> ranges_;  ///< Effective range of each row
+    size_t length_;
+    int mod_;
+    int userRange_;
+    bool rangeUpdate_;
+    bool user_;
+
+    /**
+     * @brief Cyclic index resolved once for every row: values[remainder] + range * cycles
+     */
+    struct Tap {
+        int remainder;
+        int cycles;
+    };
+
+    /**
+     * @brief Range a new PositionVector with these values would get
+     */
+    int initialRange(const int* values) const {
+        int modulo = user_ ? userRange_ : mod_;
+        if (!rangeUpdate_ || length_ == 0) {
+            return modulo;
+        }
+        auto [minIt, maxIt] = minmax_element(values, values + length_);
+        return modulo * (euclideanDivision(*maxIt - *minIt, modulo).quotient + 1);
+    }
+
+    Tap tap(int index) const {
+        int size = static_cast<int>(length_);
+        DivisionResult div = euclideanDivision(index, size);
+        return {div.remainder, (index - div.remainder) / size};
+    }
+
+    /**
+     * @brief Empty batch with the metadata of this one and another row length
+     */
+    PositionVectorBatch emptyLike(size_t length) const {
+        PositionVectorBatch out(length, mod_, userRange_, rangeUpdate_, user_);
+        out.values_.reserve(size() * length);
+        out.ranges_.reserve(size());
+        return out;
+    }
+
+    /**
+     * @brief Appends a row and computes its range
+     */
+    void appendRow(const int* values) {
+        values_.insert(values_.end(), values, values + length_);
+        ranges_.push_back(initialRange(values_.data() + values_.size() - length_));
+    }
+
+    /**
+     * @brief Reads every row through the same taps
+     */
+    PositionVectorBatch gather(const vector<Tap>& taps) const {
+        PositionVectorBatch out = emptyLike(taps.size());
+        vector<int> row(taps.size());
+        for (size_t r = 0; r < size(); ++r) {
+            const int* values = rowData(r);
+            int range = abs(ranges_[r]);
+            for (size_t k = 0; k < taps.size(); ++k) {
+                row[k] = length_ == 0 ? 0 : values[taps[k].remainder] + range * taps[k].cycles;
+            }
+            out.appendRow(row.data());
+        }
+        return out;
+    }
+
+public:
+    // ==================== CONSTRUCTORS ====================
+
+    /**
+     * @brief Creates an empty batch
+     * @param length Number of values per row
+     * @param mod Base modulus, default 12
+     * @param userRange Custom range, if 0 or negative uses mod, default 0
+     * @param rangeUpdate Flag for automatic range updating, default true
+     * @param user Flag to use userRange instead of mod, default false
+     */
+    explicit PositionVectorBatch(size_t length = 0, int mod = 12, int userRange = 0,
+                                 bool rangeUpdate = true, bool user = false)
+        : length_(length), mod_(mod), userRange_(userRange > 0 ? userRange : mod),
+          rangeUpdate_(rangeUpdate), user_(user) {}
+
+    /**
+     * @brief Packs PositionVectors into a batch
+     * @param vectors Vectors of equal length and metadata (the range may differ)
+     * @throw invalid_argument If the lengths or the metadata differ
+     */
+    explicit PositionVectorBatch(const vector<PositionVector>& vectors)
+        : PositionVectorBatch() {
+        if (vectors.empty()) {
+            return;
+        }
+        const PositionVector& first = vectors.front();
+        *this = PositionVectorBatch(first.size(), first.mod, first.userRange, first.rangeUpdate, first.user);
+        reserve(vectors.size());
+        for (const PositionVector& pv : vectors) {
+            push_back(pv);
+        }
+    }
+
+    // ==================== MODIFIERS ====================
+
+    void reserve(size_t rows) {
+        values_.reserve(rows * length_);
+        ranges_.reserve(rows);
+    }
+
+    void clear() {
+        values_.clear();
+        ranges_.clear();
+    }
+
+    /**
+     * @brief Appends a row with the shared metadata
+     * @throw invalid_argument If the row length differs from the batch length
+     */
+    void push_back(const VectorData& values) {
+        if (values.size() != length_) {
+            throw invalid_argument("PositionVectorBatch row length mismatch");
+        }
+        appendRow(values.data());
+    }
+
+    /**
+     * @brief Appends a PositionVector, keeping its range
+     * @throw invalid_argument If its length or metadata differ from the batch
+     */
+    void push_back(const PositionVector& pv) {
+        if (pv.size() != length_) {
+            throw invalid_argument("PositionVectorBatch row length mismatch");
+        }
+        if (pv.mod != mod_ || pv.userRange != userRange_ || pv.rangeUpdate != rangeUpdate_ || pv.user != user_) {
+            throw invalid_argument("PositionVectorBatch row metadata mismatch");
+        }
+        values_.insert(values_.end(), pv.data.begin(), pv.data.end());
+        ranges_.push_back(pv.range);
+    }
+
+    // ==================== GETTERS ====================
+
+    size_t size() const { return ranges_.size(); }
+    bool empty() const { return ranges_.empty(); }
+    size_t length() const { return length_; }
+    int getMod() const { return mod_; }
+    int getUserRange() const { return userRange_; }
+    bool getRangeUpdate() const { return rangeUpdate_; }
+    bool getUser() const { return user_; }
+
+    /**
+     * @brief All values, row after row
+     */
+    const vector<int>& values() const { return values_; }
+
+    const int* rowData(size_t row) const { return values_.data() + row * length_; }
+    int rowRange(size_t row) const { return ranges_[row]; }
+
+    /**
+     * @brief Non-owning view of a row
+     */
+    Row row(size_t row) const {
+        return PositionVectorView(rowData(row), length_, mod_, userRange_, ranges_[row], rangeUpdate_, user_);
+    }
+    Row operator[](size_t row) const { return this->row(row); }
+
+    /**
+     * @brief Cyclic access to a row, same as PositionVector::element
+     */
+    int element(size_t row, int index) const { return this->row(row).element(index); }
+
+    /**
+     * @brief Copies a row into a PositionVector
+     */
+    PositionVector toVector(size_t row) const { return this->row(row).toVector(); }
+
+    vector<PositionVector> toVectors() const {
+        vector<PositionVector> out;
+        out.reserve(size());
+        for (size_t r = 0; r < size(); ++r) {
+            out.push_back(toVector(r));
+        }
+        return out;
+    }
+
+    // ==================== BATCH OPERATIONS ====================
+
+    /**
+     * @brief Adds an interval to every value, same as pv + interval on each row
+     */
+    PositionVectorBatch transpose(int interval) const {
+        PositionVectorBatch out = emptyLike(length_);
+        out.values_ = values_;
+        for (int& value : out.values_) {
+            value += interval;
+        }
+        for (size_t r = 0; r < size(); ++r) {
+            out.ranges_.push_back(out.initialRange(out.rowData(r)));
+        }
+        return out;
+    }
+
+    /**
+     * @brief PositionVector::rotate on each row
+     */
+    PositionVectorBatch rotate(int rotationAmount) const {
+        if (length_ == 0) {
+            return *this;
+        }
+        int size = static_cast<int>(length_);
+        vector<Tap> taps(length_);
+        for (int i = 0; i < size; ++i) {
+            taps[(i + abs(rotationAmount)) % size] = {i, 0};
+        }
+        return gather(taps);
+    }
+
+    /**
+     * @brief PositionVector::rotoTranslate on each row
+     */
+    PositionVectorBatch rotoTranslate(int startOffset, int length = 0) const {
+        int outLength = (length == 0) ? static_cast<int>(length_) : abs(length);
+        vector<Tap> taps(static_cast<size_t>(outLength), Tap{0, 0});
+        if (length_ > 0) {
+            for (int i = 0; i < outLength; ++i) {
+                taps[i] = tap(startOffset + i);
+            }
+        }
+        return gather(taps);
+    }
+
+    /**
+     * @brief PositionVector::inversion on each row
+     */
+    PositionVectorBatch inversion(int axisIndex, bool sortOutput = true) const {
+        if (length_ == 0) {
+            return *this;
+        }
+        int axis = euclideanDivision(axisIndex, static_cast<int>(length_)).remainder;
+        PositionVectorBatch out = emptyLike(length_);
+        vector<int> row(length_);
+        for (size_t r = 0; r < size(); ++r) {
+            const int* values = rowData(r);
+            for (size_t i = 0; i < length_; ++i) {
+                row[i] = 2 * values[axis] - values[i];
+            }
+            if (sortOutput) {
+                sort(row.begin(), row.end());
+            }
+            out.appendRow(row.data());
+        }
+        return out;
+    }
+
+    /**
+     * @brief Position-based selection on each row, same as select(row, criterion, ...)
+     * @throw invalid_argument If the batch length is 0
+     */
+    PositionVectorBatch select(const PositionVector& criterion, int criterionRotation = 0, int voices = 0) const {
+        if (length_ == 0) {
+            throw invalid_argument("Cannot select from an empty row");
+        }
+        PositionVector actualCriterion(criterion.getData(), static_cast<int>(length_));
+        actualCriterion.setMod(static_cast<int>(length_));
+        PositionVector rotatedCriterion = (criterionRotation != 0)
+            ? actualCriterion.rotoTranslate(criterionRotation, voices)
+            : actualCriterion;
+        int outLength = (voices > 0) ? voices : static_cast<int>(rotatedCriterion.size());
+        vector<Tap> taps(static_cast<size_t>(outLength));
+        for (int k = 0; k < outLength; ++k) {
+            taps[k] = tap(rotatedCriterion[k]);
+        }
+        return gather(taps);
+    }
+
+    /**
+     * @brief Interval-based selection on each row, same as select(row, criterion, ...)
+     * @throw invalid_argument If the batch length is 0
+     */
+    PositionVectorBatch select(const IntervalVector& criterion, int criterionRotation = 0, int voices = 0) const {
+        if (length_ == 0) {
+            throw invalid_argument("Cannot select from an empty row");
+        }
+        IntervalVector actualCriterion = criterion;
+        actualCriterion.setMod(static_cast<int>(length_));
+        IntervalVector rotatedCriterion = (criterionRotation != 0)
+            ? actualCriterion.rotate(criterionRotation, voices)
+            : actualCriterion;
+        int outLength = (voices > 0) ? voices : static_cast<int>(rotatedCriterion.size());
+        vector<Tap> taps(static_cast<size_t>(outLength));
+        int cumulativePosition = rotatedCriterion.getOffset();
+        for (int k = 0; k < outLength; ++k) {
+            taps[k] = tap(cumulativePosition);
+            cumulativePosition += rotatedCriterion[k];
+        }
+        return gather(taps);
+    }
+
+    // ==================== DISTANCES ====================
+
+    /**
+     * @brief Distance from a reference to every row
+     * @param reference Reference vector
+     * @param distFunc Distance callable, default Manhattan
+     * @return Distances in row order
+     * @details Policies with a batch kernel run it on the block itself when the reference
+     *          has the batch length; other callables get each row as a PositionVector.
+     */
+    template<typename Dist = ManhattanDistancePolicy>
+    vector<double> distances(const PositionVector& reference, Dist distFunc = Dist()) const {
+        vector<double> out(size());
+        if constexpr (BatchDistanceKernel<Dist>::available) {
+            if (reference.size() == length_) {
+                vector<typename BatchDistanceKernel<Dist>::Out> raw(size());
+                BatchDistanceKernel<Dist>::run(reference.data.data(), values_.data(), length_, size(), raw.data());
+                copy(raw.begin(), raw.end(), out.begin());
+                return out;
+            }
+        }
+        for (size_t r = 0; r < size(); ++r) {
+            out[r] = evaluateDistance(distFunc, reference, toVector(r));
+        }
+        return out;
+    }
+};
+
+// ==================== INTERVAL VECTOR BATCH ====================
+
+/**
+ * @class IntervalVectorBatch
+ * @brief N IntervalVectors of length K in one contiguous block
+ * @details mod is shared, the offset is stored per row.
+ */
+class IntervalVectorBatch {
+public:
+    /**
+     * @brief Non-owning view of one row, valid until the batch is modified
+     */
+    using Row = IntervalVectorView;
+
+private:
+    vector<int> values_;   ///< Row-major values, row i at i * length_
+    vector<int> offsets_;  ///< Offset of each row
+    size_t length_;
+    int mod_;
+
+    /**
+     * @brief Linear map resolved once for every row
+     * @details Output value k is the sum of weights[k * length_ + i] * row[i], the output
+     *          offset is the row offset plus the sum of offsetWeights[i] * row[i].
+     */
+    struct LinearPlan {
+        size_t outLength;
+        vector<int> weights;
+        vector<int> offsetWeights;
+    };
+
+    LinearPlan makePlan(size_t outLength) const {
+        return {outLength, vector<int>(outLength * length_, 0), vector<int>(length_, 0)};
+    }
+
+    int wrap(int index) const {
+        return euclideanDivision(index, static_cast<int>(length_)).remainder;
+    }
+
+    IntervalVectorBatch emptyLike(size_t length) const {
+        IntervalVectorBatch out(length, mod_);
+        out.values_.reserve(size() * length);
+        out.offsets_.reserve(size());
+        return out;
+    }
+
+    /**
+     * @brief Reads every row through the same source indices
+     */
+    IntervalVectorBatch gather(const vector<int>& indices) const {
+        IntervalVectorBatch out = emptyLike(indices.size());
+        for (size_t r = 0; r < size(); ++r) {
+            const int* values = rowData(r);
+            for (int index : indices) {
+                out.values_.push_back(length_ == 0 ? 0 : values[index]);
+            }
+            out.offsets_.push_back(offsets_[r]);
+        }
+        return out;
+    }
+
+    IntervalVectorBatch apply(const LinearPlan& plan) const {
+        IntervalVectorBatch out = emptyLike(plan.outLength);
+        for (size_t r = 0; r < size(); ++r) {
+            const int* values = rowData(r);
+            for (size_t k = 0; k < plan.outLength; ++k) {
+                const int* weights = plan.weights.data() + k * length_;
+                int sum = 0;
+                for (size_t i = 0; i < length_; ++i) {
+                    sum += weights[i] * values[i];
+                }
+                out.values_.push_back(sum);
+            }
+            int offset = offsets_[r];
+            for (size_t i = 0; i < length_; ++i) {
+                offset += plan.offsetWeights[i] * values[i];
+            }
+            out.offsets_.push_back(offset);
+        }
+        return out;
+    }
+
+public:
+    // ==================== CONSTRUCTORS ====================
+
+    /**
+     * @brief Creates an empty batch
+     * @param length Number of values per row
+     * @param mod Modulo, default 12
+     */
+    explicit IntervalVectorBatch(size_t length = 0, int mod = 12) : length_(length), mod_(mod) {}
+
+    /**
+     * @brief Packs IntervalVectors into a batch
+     * @param vectors Vectors of equal length and modulo (the offset may differ)
+     * @throw invalid_argument If the lengths or the moduli differ
+     */
+    explicit IntervalVectorBatch(const vector<IntervalVector>& vectors) : IntervalVectorBatch() {
+        if (vectors.empty()) {
+            return;
+        }
+        *this = IntervalVectorBatch(vectors.front().size(), vectors.front().mod);
+        reserve(vectors.size());
+        for (const IntervalVector& iv : vectors) {
+            push_back(iv);
+        }
+    }
+
+    // ==================== MODIFIERS ====================
+
+    void reserve(size_t rows) {
+        values_.reserve(rows * length_);
+        offsets_.reserve(rows);
+    }
+
+    void clear() {
+        values_.clear();
+        offsets_.clear();
+    }
+
+    /**
+     * @brief Appends a row
+     * @throw invalid_argument If the row length differs from the batch length
+     */
+    void push_back(const VectorData& values, int offset = 0) {
+        if (values.size() != length_) {
+            throw invalid_argument("IntervalVectorBatch row length mismatch");
+        }
+        values_.insert(values_.end(), values.begin(), values.end());
+        offsets_.push_back(offset);
+    }
+
+    /**
+     * @brief Appends an IntervalVector
+     * @throw invalid_argument If its length or modulo differ from the batch
+     */
+    void push_back(const IntervalVector& iv) {
+        if (iv.mod != mod_) {
+            throw invalid_argument("IntervalVectorBatch row metadata mismatch");
+        }
+        push_back(iv.data, iv.offset);
+    }
+
+    // ==================== GETTERS ====================
+
+    size_t size() const { return offsets_.size(); }
+    bool empty() const { return offsets_.empty(); }
+    size_t length() const { return length_; }
+    int getMod() const { return mod_; }
+
+    /**
+     * @brief All values, row after row
+     */
+    const vector<int>& values() const { return values_; }
+
+    const int* rowData(size_t row) const { return values_.data() + row * length_; }
+    int rowOffset(size_t row) const { return offsets_[row]; }
+
+    /**
+     * @brief Non-owning view of a row
+     */
+    Row row(size_t row) const { return IntervalVectorView::fromBuffer(rowData(row), length_, offsets_[row], mod_); }
+    Row operator[](size_t row) const { return this->row(row); }
+
+    /**
+     * @brief Copies a row into an IntervalVector
+     */
+    IntervalVector toVector(size_t row) const { return this->row(row).toVector(); }
+
+    vector<IntervalVector> toVectors() const {
+        vector<IntervalVector> out;
+        out.reserve(size());
+        for (size_t r = 0; r < size(); ++r) {
+            out.push_back(toVector(r));
+        }
+        return out;
+    }
+
+    // ==================== BATCH OPERATIONS ====================
+
+    /**
+     * @brief IntervalVector::rotate on each row
+     */
+    IntervalVectorBatch rotate(int r, int n = 0) const {
+        n = abs(n);
+        if (n == 0) n = static_cast<int>(length_);
+        vector<int> indices(static_cast<size_t>(n), 0);
+        if (length_ > 0) {
+            for (int i = 0; i < n; ++i) {
+                indices[i] = wrap(r + i);
+            }
+        }
+        return gather(indices);
+    }
+
+    /**
+     * @brief IntervalVector::rotoTranslate on each row
+     * @details The skipped intervals added to the offset are counted once per index.
+     */
+    IntervalVectorBatch rotoTranslate(int r, int n = 0) const {
+        IntervalVectorBatch out = rotate(r, n);
+        if (length_ == 0) {
+            return out;
+        }
+        int dataSize = static_cast<int>(length_);
+        vector<int> weights(length_, 0);
+        if (abs(r) < dataSize) {
+            if (r >= 0) {
+                for (int i = 0; i < r; ++i) weights[i] += 1;
+            } else {
+                for (int i = 0; i < -r; ++i) weights[dataSize - 1 - i] -= 1;
+            }
+        } else {
+            DivisionResult div = euclideanDivision(r, dataSize);
+            if (r >= 0) {
+                for (int i = 0; i < dataSize; ++i) {
+                    weights[i] = (i < div.remainder) ? (div.quotient + 1) : div.quotient;
+                }
+            } else {
+                int thresh = dataSize + div.remainder;
+                for (int i = 0; i < dataSize; ++i) {
+                    weights[i] = (i >= thresh) ? (div.quotient - 1) : div.quotient;
+                }
+            }
+        }
+        for (size_t row = 0; row < size(); ++row) {
+            const int* values = rowData(row);
+            for (size_t i = 0; i < length_; ++i) {
+                out.offsets_[row] += weights[i] * values[i];
+            }
+        }
+        return out;
+    }
+
+    /**
+     * @brief IntervalVector::reverse on each row
+     */
+    IntervalVectorBatch reverse() const {
+        vector<int> indices(length_);
+        for (size_t i = 0; i < length_; ++i) {
+            indices[i] = static_cast<int>(length_ - 1 - i);
+        }
+        return gather(indices);
+    }
+
+    IntervalVectorBatch retrograde() const {
+        return reverse();
+    }
+
+    /**
+     * @brief IntervalVector::inversion on each row
+     */
+    IntervalVectorBatch inversion(int axisIndex = 0) const {
+        if (length_ == 0) {
+            return *this;
+        }
+        int size = static_cast<int>(length_);
+        int axis = euclideanDivision(axisIndex, size + 1).remainder;
+        vector<int> indices(length_);
+        for (int i = 0; i < size; ++i) {
+            indices[i] = (i < axis) ? axis - 1 - i : size - 1 - (i - axis);
+        }
+        return gather(indices);
+    }
+
+    /**
+     * @brief Interval-based selection on each row, same as select(row, indices, ...)
+     * @throw invalid_argument If the batch length is 0
+     */
+    IntervalVectorBatch select(const IntervalVector& indices, int criterionRotation = 0, int voices = 0) const {
+        if (length_ == 0) {
+            throw invalid_argument("Cannot select from an empty row");
+        }
+        IntervalVector actualCriterion = indices;
+        actualCriterion.setMod(static_cast<int>(length_));
+        IntervalVector rotatedCriterion = (criterionRotation != 0)
+            ? actualCriterion.rotate(criterionRotation, voices)
+            : actualCriterion;
+        int criterionOffset = rotatedCriterion.getOffset();
+        int outLength = (voices > 0) ? voices : static_cast<int>(rotatedCriterion.size());
+        LinearPlan plan = makePlan(static_cast<size_t>(outLength));
+        for (int j = 0; j < criterionOffset; ++j) {
+            plan.offsetWeights[wrap(j)] += 1;
+        }
+        int cumulativeIndex = criterionOffset;
+        for (int k = 0; k < outLength; ++k) {
+            int spanLength = rotatedCriterion[k];
+            for (int j = 0; j < spanLength; ++j) {
+                plan.weights[k * length_ + wrap(cumulativeIndex + j)] += 1;
+            }
+            cumulativeIndex += spanLength;
+        }
+        return apply(plan);
+    }
+
+    /**
+     * @brief Position-based selection on each row, same as select(row, criterion, ...)
+     * @throw invalid_argument If the batch length is 0
+     */
+    IntervalVectorBatch select(const PositionVector& criterion, int criterionRotation = 0, int voices = 0) const {
+        if (length_ == 0) {
+            throw invalid_argument("Cannot select from an empty row");
+        }
+        int n = static_cast<int>(length_);
+        PositionVector actualCriterion = criterion;
+        actualCriterion.setMod(n);
+        PositionVector rotatedCriterion = (criterionRotation != 0)
+            ? actualCriterion.rotoTranslate(criterionRotation, voices)
+            : actualCriterion;
+        if (rotatedCriterion.size() == 0) {
+            IntervalVectorBatch out = emptyLike(0);
+            out.offsets_ = offsets_;
+            return out;
+        }
+        int outLength = (voices > 0) ? voices : static_cast<int>(rotatedCriterion.size());
+        LinearPlan plan = makePlan(static_cast<size_t>(outLength));
+        for (int k = 0; k < outLength; ++k) {
+            int p_k = rotatedCriterion[k];
+            int delta_k = rotatedCriterion[k + 1] - p_k;
+            if (delta_k <= 0) {
+                delta_k += n;
+            }
+            for (int j = 0; j < delta_k; ++j) {
+                plan.weights[k * length_ + wrap(p_k + j)] += 1;
+            }
+        }
+        if (criterion[0] >= 0) {
+            for (int j = 0; j < criterion[0]; ++j) plan.offsetWeights[wrap(j)] += 1;
+        } else {
+            for (int j = criterion[0]; j < 0; ++j) plan.offsetWeights[wrap(j)] -= 1;
+        }
+        return apply(plan);
+    }
+
+    // ==================== DISTANCES ====================
+
+    /**
+     * @brief Distance from a reference to every row
+     * @see PositionVectorBatch::distances
+     */
+    template<typename Dist = ManhattanDistancePolicy>
+    vector<double> distances(const IntervalVector& reference, Dist distFunc = Dist()) const {
+        vector<double> out(size());
+        if constexpr (BatchDistanceKernel<Dist>::available) {
+            if (reference.size() == length_) {
+                vector<typename BatchDistanceKernel<Dist>::Out> raw(size());
+                BatchDistanceKernel<Dist>::run(reference.data.data(), values_.data(), length_, size(), raw.data());
+                copy(raw.begin(), raw.end(), out.begin());
+                return out;
+            }
+        }
+        for (size_t r = 0; r < size(); ++r) {
+            out[r] = evaluateDistance(distFunc, reference, toVector(r));
+        }
+        return out;
+    }
+};
+
+#endif // VECTOR_BATCH_H
@@ -0,0 +1,313 @@
+#ifndef VECTOREXPRESSION_H
+#define VECTOREXPRESSION_H
+
+#include "./mathUtil.h"
+#include "./smallVector.h"
+
+/**
+ * @file vectorExpression.h
+ * @brief Expression templates for PositionVector and IntervalVector arithmetic
+ * @author [not251]
+ * @date 2025
+ * @details The operators of PositionVector and IntervalVector return new vectors. A chain
+ *          started with lazy() instead builds lightweight expression objects:
+ *          `PositionVector r = (lazy(pv) + 3) * 2 % 12;` is computed in a single pass when
+ *          it is converted back to a vector, so there are no intermediate allocations and
+ *          the range is computed only once.
+ *
+ *          lazy(pv) on a named vector refers to it, so pv must outlive the expression.
+ *          lazy() on a temporary and the right-hand operands are held by value.
+ */
+
+// ==================== ELEMENT OPERATIONS ====================
+
+/**
+ * @brief Addition
+ */
+struct ExprAdd {
+    static int apply(int a, int b) { return a + b; }
+    static constexpr bool emptyYieldsEmpty = false;
+    static constexpr bool divides = false;
+};
+
+/**
+ * @brief Subtraction
+ */
+struct ExprSubtract {
+    static int apply(int a, int b) { return a - b; }
+    static constexpr bool emptyYieldsEmpty = false;
+    static constexpr bool divides = false;
+};
+
+/**
+ * @brief Multiplication
+ */
+struct ExprMultiply {
+    static int apply(int a, int b) { return a * b; }
+    static constexpr bool emptyYieldsEmpty = true;
+    static constexpr bool divides = false;
+};
+
+/**
+ * @brief Euclidean quotient
+ */
+struct ExprDivide {
+    static int apply(int a, int b) { return euclideanDivision(a, b).quotient; }
+    static constexpr bool emptyYieldsEmpty = true;
+    static constexpr bool divides = true;
+    static constexpr const char* emptyError = "Cannot divide by empty vector";
+    static constexpr const char* zeroError = "Division by zero in componentwise division";
+};
+
+/**
+ * @brief Euclidean remainder
+ */
+struct ExprModulo {
+    static int apply(int a, int b) { return euclideanDivision(a, b).remainder; }
+    static constexpr bool emptyYieldsEmpty = true;
+    static constexpr bool divides = true;
+    static constexpr const char* emptyError = "Cannot compute modulo with empty vector";
+    static constexpr const char* zeroError = "Division by zero in componentwise modulo";
+};
+
+template<typename E, typename Op> class ScalarExpr;
+template<typename E, typename Op> class ComponentwiseExpr;
+
+// ==================== EXPRESSION BASE ====================
+
+/**
+ * @brief CRTP base shared by all vector expressions
+ * @tparam Derived Concrete expression type (must provide size(), at(i) and source())
+ * @tparam Vec Vector type produced on evaluation (PositionVector or IntervalVector)
+ */
+template<typename Derived, typename Vec>
+class VectorExpression {
+public:
+    using vector_type = Vec;
+
+    const Derived& self() const { return static_cast<const Derived&>(*this); }
+
+    /**
+     * @brief Computes every element of the expression in one pass
+     * @return Raw data of the resulting vector
+     */
+    VectorData evaluate() const {
+        size_t n = self().size();
+        VectorData out(n);
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = self().at(i);
+        }
+        return out;
+    }
+
+    /**
+     * @brief Evaluates the expression into a vector
+     * @return Vector carrying the properties of the leftmost operand
+     */
+    Vec eval() const { return Vec(self()); }
+
+    // ==================== SCALAR OPERATORS ====================
+
+    ScalarExpr<Derived, ExprAdd> operator+(int scalar) const {
+        return ScalarExpr<Derived, ExprAdd>(self(), scalar);
+    }
+    ScalarExpr<Derived, ExprSubtract> operator-(int scalar) const {
+        return ScalarExpr<Derived, ExprSubtract>(self(), scalar);
+    }
+    ScalarExpr<Derived, ExprMultiply> operator*(int scalar) const {
+        return ScalarExpr<Derived, ExprMultiply>(self(), scalar);
+    }
+    ScalarExpr<Derived, ExprDivide> operator/(int divisor) const {
+        return ScalarExpr<Derived, ExprDivide>(self(), divisor);
+    }
+    ScalarExpr<Derived, ExprModulo> operator%(int divisor) const {
+        return ScalarExpr<Derived, ExprModulo>(self(), divisor);
+    }
+
+    // ==================== COMPONENT-WISE OPERATORS ====================
+
+    ComponentwiseExpr<Derived, ExprAdd> operator+(const Vec& other) const {
+        return ComponentwiseExpr<Derived, ExprAdd>(self(), other.data, false);
+    }
+    ComponentwiseExpr<Derived, ExprSubtract> operator-(const Vec& other) const {
+        return ComponentwiseExpr<Derived, ExprSubtract>(self(), other.data, false);
+    }
+    ComponentwiseExpr<Derived, ExprMultiply> operator*(const Vec& other) const {
+        return ComponentwiseExpr<Derived, ExprMultiply>(self(), other.data, true);
+    }
+    ComponentwiseExpr<Derived, ExprDivide> operator/(const Vec& other) const {
+        return ComponentwiseExpr<Derived, ExprDivide>(self(), other.data, true);
+    }
+    ComponentwiseExpr<Derived, ExprModulo> operator%(const Vec& other) const {
+        return ComponentwiseExpr<Derived, ExprModulo>(self(), other.data, true);
+    }
+
+    ComponentwiseExpr<Derived, ExprAdd> operator+(const VectorData& other) const {
+        return ComponentwiseExpr<Derived, ExprAdd>(self(), other, false);
+    }
+    ComponentwiseExpr<Derived, ExprSubtract> operator-(const VectorData& other) const {
+        return ComponentwiseExpr<Derived, ExprSubtract>(self(), other, false);
+    }
+    ComponentwiseExpr<Derived, ExprMultiply> operator*(const VectorData& other) const {
+        return ComponentwiseExpr<Derived, ExprMultiply>(self(), other, true);
+    }
+    ComponentwiseExpr<Derived, ExprDivide> operator/(const VectorData& other) const {
+        return ComponentwiseExpr<Derived, ExprDivide>(self(), other, true);
+    }
+    ComponentwiseExpr<Derived, ExprModulo> operator%(const VectorData& other) const {
+        return ComponentwiseExpr<Derived, ExprModulo>(self(), other, true);
+    }
+
+    // ==================== FRIEND OPERATORS ====================
+
+    friend ScalarExpr<Derived, ExprAdd> operator+(int scalar, const VectorExpression& e) {
+        return e + scalar;
+    }
+    friend ScalarExpr<Derived, ExprSubtract> operator-(int scalar, const VectorExpression& e) {
+        return e - scalar;
+    }
+    friend ScalarExpr<Derived, ExprMultiply> operator*(int scalar, const VectorExpression& e) {
+        return e * scalar;
+    }
+
+    friend ostream& operator<<(ostream& os, const VectorExpression& e) {
+        return os << e.eval();
+    }
+};
+
+// ==================== EXPRESSION NODES ====================
+
+/**
+ * @brief Leaf expression referring to an existing vector
+ * @tparam Vec PositionVector or IntervalVector
+ */
+template<typename Vec>
+class VectorLeaf : public VectorExpression<VectorLeaf<Vec>, Vec> {
+private:
+    const Vec* vec_;
+
+public:
+    explicit VectorLeaf(const Vec& vec) : vec_(&vec) {}
+
+    size_t size() const { return vec_->data.size(); }
+    int at(size_t i) const { return vec_->data[i]; }
+    const Vec& source() const { return *vec_; }
+};
+
+/**
+ * @brief Leaf expression owning its vector
+ * @tparam Vec PositionVector or IntervalVector
+ * @details Built by lazy() on a temporary, so the chain does not refer to a destroyed vector.
+ */
+template<typename Vec>
+class OwnedVectorLeaf : public VectorExpression<OwnedVectorLeaf<Vec>, Vec> {
+private:
+    Vec vec_;
+
+public:
+    explicit OwnedVectorLeaf(Vec vec) : vec_(move(vec)) {}
+
+    size_t size() const { return vec_.data.size(); }
+    int at(size_t i) const { return vec_.data[i]; }
+    const Vec& source() const { return vec_; }
+};
+
+/**
+ * @brief Element-wise operation between an expression and a scalar
+ * @tparam E Operand expression
+ * @tparam Op Element operation
+ */
+template<typename E, typename Op>
+class ScalarExpr : public VectorExpression<ScalarExpr<E, Op>, typename E::vector_type> {
+private:
+    E operand_;
+    int scalar_;
+
+public:
+    /**
+     * @throw invalid_argument If Op divides and the scalar is 0
+     */
+    ScalarExpr(const E& operand, int scalar) : operand_(operand), scalar_(scalar) {
+        if (Op::divides && scalar == 0) {
+            throw invalid_argument("Division by zero");
+        }
+    }
+
+    size_t size() const { return operand_.size(); }
+    int at(size_t i) const { return Op::apply(operand_.at(i), scalar_); }
+    const typename E::vector_type& source() const { return operand_.source(); }
+};
+
+/**
+ * @brief Component-wise operation between an expression and a data vector
+ * @tparam E Left operand expression
+ * @tparam Op Element operation
+ * @details The right operand is copied, so it may be a temporary. Follows the rules of the componentwise* methods:
+ *          - looping: length max(size1, size2), both operands wrap cyclically
+ *          - no looping: operation up to min(size1, size2), then the remaining
+ *            elements of the longer operand are appended unchanged
+ *          - sum/subtraction with an empty operand yield the other operand
+ *          - product, division and modulo with an empty left operand yield an empty vector
+ */
+template<typename E, typename Op>
+class ComponentwiseExpr : public VectorExpression<ComponentwiseExpr<E, Op>, typename E::vector_type> {
+private:
+    E operand_;
+    VectorData other_;
+    size_t leftSize_;
+    size_t rightSize_;
+    size_t size_;
+    bool looping_;
+
+public:
+    /**
+     * @throw invalid_argument If Op divides and other is empty or contains zeros
+     */
+    ComponentwiseExpr(const E& operand, const VectorData& other, bool useLooping)
+        : operand_(operand), other_(other),
+          leftSize_(operand.size()), rightSize_(other.size()),
+          size_(0), looping_(useLooping)
+    {
+        if constexpr (Op::divides) {
+            if (rightSize_ == 0) {
+                throw invalid_argument(Op::emptyError);
+            }
+            if (leftSize_ > 0) {
+                for (int val : other) {
+                    if (val == 0) {
+                        throw invalid_argument(Op::zeroError);
+                    }
+                }
+            }
+        }
+
+        if (Op::emptyYieldsEmpty && (leftSize_ == 0 || rightSize_ == 0)) {
+            size_ = 0;
+        } else {
+            size_ = max(leftSize_, rightSize_);
+        }
+        looping_ = useLooping && leftSize_ > 0 && rightSize_ > 0;
+    }
+
+    size_t size() const { return size_; }
+
+    int at(size_t i) const {
+        if (looping_) {
+            return Op::apply(operand_.at(i % leftSize_), other_[i % rightSize_]);
+        }
+        if (i < leftSize_ && i < rightSize_) {
+            return Op::apply(operand_.at(i), other_[i]);
+        }
+        return i < leftSize_ ? operand_.at(i) : other_[i];
+    }
+
+    const typename E::vector_type& source() const { return operand_.source(); }
+};
+
+/**
+ * @brief Detects vector expressions producing the given vector type
+ */
+template<typename E, typename Vec>
+using IsVectorExpression = is_base_of<VectorExpression<E, Vec>, E>;
+
+#endif // VECTOREXPRESSION_H
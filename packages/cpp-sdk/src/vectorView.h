@@ -0,0 +1,179 @@
+#ifndef VECTOR_VIEW_H
+#define VECTOR_VIEW_H
+
+#include "./positionVector.h"
+#include "./intervalVector.h"
+
+/**
+ * @file vectorView.h
+ * @brief Non-owning views of position and interval data held by the caller
+ * @author [not251]
+ * @date 2025
+ * @details A view reads an int buffer in place (a MIDI note array, a row of a
+ *          PositionVectorBatch, the data of an existing vector) together with the metadata
+ *          a vector would carry, and behaves as that vector for read-only use: size, cyclic
+ *          access and metadata getters. select, chord, the distance functions and quantize
+ *          accept views directly. The buffer must outlive the view and is never modified.
+ *
+ *          A PositionVector or IntervalVector converts implicitly to its view. Raw buffers
+ *          go through fromBuffer, so braced lists keep selecting the owning overloads.
+ */
+
+// ==================== POSITION VECTOR VIEW ====================
+
+/**
+ * @class PositionVectorView
+ * @brief Read-only PositionVector over an external buffer
+ */
+class PositionVectorView {
+private:
+    const int* data_;
+    size_t size_;
+    int mod_;
+    int userRange_;
+    int range_;
+    bool rangeUpdate_;
+    bool user_;
+
+    friend class PositionVectorBatch;
+
+    PositionVectorView(const int* data, size_t size, int mod, int userRange, int range,
+                       bool rangeUpdate, bool user)
+        : data_(data), size_(size), mod_(mod), userRange_(userRange), range_(range),
+          rangeUpdate_(rangeUpdate), user_(user) {}
+
+public:
+    /**
+     * @brief Views the data of a PositionVector, with its metadata and range
+     */
+    PositionVectorView(const PositionVector& pv)
+        : PositionVectorView(pv.data.data(), pv.data.size(), pv.mod, pv.userRange, pv.range,
+                             pv.rangeUpdate, pv.user) {}
+
+    /**
+     * @brief Views a caller's buffer
+     * @param data First value
+     * @param size Number of values
+     * @param mod Base modulus, default 12
+     * @param userRange Custom range, if 0 or negative uses mod, default 0
+     * @param rangeUpdate Flag for automatic range updating, default true
+     * @param user Flag to use userRange instead of mod, default false
+     * @return View with the range a PositionVector with these arguments would get
+     */
+    static PositionVectorView fromBuffer(const int* data, size_t size, int mod = 12, int userRange = 0,
+                                         bool rangeUpdate = true, bool user = false) {
+        userRange = userRange > 0 ? userRange : mod;
+        int modulo = user ? userRange : mod;
+        int range = modulo;
+        if (rangeUpdate && size > 0) {
+            auto [minIt, maxIt] = minmax_element(data, data + size);
+            range = modulo * (euclideanDivision(*maxIt - *minIt, modulo).quotient + 1);
+        }
+        return PositionVectorView(data, size, mod, userRange, range, rangeUpdate, user);
+    }
+
+    // ==================== ACCESS ====================
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    const int* data() const { return data_; }
+    const int* begin() const { return data_; }
+    const int* end() const { return data_ + size_; }
+
+    /**
+     * @brief Cyclic access, same as PositionVector::element
+     */
+    int element(int index) const {
+        int size = static_cast<int>(size_);
+        if (size == 0) {
+            return 0;
+        }
+        DivisionResult div = euclideanDivision(index, size);
+        int cycles = (index - div.remainder) / size;
+        return data_[div.remainder] + abs(range_) * cycles;
+    }
+
+    int operator[](int index) const { return element(index); }
+
+    int getMod() const { return mod_; }
+    int getUserRange() const { return userRange_; }
+    int getRange() const { return range_; }
+    bool getRangeUpdate() const { return rangeUpdate_; }
+    bool getUser() const { return user_; }
+
+    /**
+     * @brief Copies the viewed values into a PositionVector with the same metadata and range
+     */
+    PositionVector toVector() const {
+        PositionVector pv(VectorData(begin(), end()), mod_, userRange_, rangeUpdate_, user_);
+        pv.range = range_;
+        return pv;
+    }
+};
+
+// ==================== INTERVAL VECTOR VIEW ====================
+
+/**
+ * @class IntervalVectorView
+ * @brief Read-only IntervalVector over an external buffer
+ */
+class IntervalVectorView {
+private:
+    const int* data_;
+    size_t size_;
+    int offset_;
+    int mod_;
+
+    IntervalVectorView(const int* data, size_t size, int offset, int mod)
+        : data_(data), size_(size), offset_(offset), mod_(mod) {}
+
+public:
+    /**
+     * @brief Views the data of an IntervalVector, with its offset and modulo
+     */
+    IntervalVectorView(const IntervalVector& iv)
+        : IntervalVectorView(iv.data.data(), iv.data.size(), iv.offset, iv.mod) {}
+
+    /**
+     * @brief Views a caller's buffer
+     * @param data First value
+     * @param size Number of values
+     * @param offset Offset, default 0
+     * @param mod Modulo, default 12
+     */
+    static IntervalVectorView fromBuffer(const int* data, size_t size, int offset = 0, int mod = 12) {
+        return IntervalVectorView(data, size, offset, mod);
+    }
+
+    // ==================== ACCESS ====================
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    const int* data() const { return data_; }
+    const int* begin() const { return data_; }
+    const int* end() const { return data_ + size_; }
+
+    /**
+     * @brief Cyclic access, same as IntervalVector::element
+     */
+    int element(int index) const {
+        if (size_ == 0) {
+            return 0;
+        }
+        return data_[euclideanDivision(index, static_cast<int>(size_)).remainder];
+    }
+
+    int operator[](int index) const { return element(index); }
+
+    int getOffset() const { return offset_; }
+    int getMod() const { return mod_; }
+
+    /**
+     * @brief Copies the viewed values into an IntervalVector
+     */
+    IntervalVector toVector() const {
+        return IntervalVector(VectorData(begin(), end()), offset_, mod_);
+    }
+};
+
+#endif // VECTOR_VIEW_H
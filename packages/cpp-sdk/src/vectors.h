@@ -4,6 +4,8 @@
 #include "./positionVector.h"
 #include "./intervalVector.h"
 #include "./binaryVector.h"
+#include "./pitchClassMask.h"
+#include "./vectorView.h"
 
 /**
  * @file Vectors.h
@@ -17,14 +19,14 @@
      * @brief Converts positions to intervals
      * @return IntervalVector derived from current positions
      */
-    IntervalVector positionsToIntervals(PositionVector positions) {
+    IntervalVector positionsToIntervals(const PositionVector& positions) {
         int mod = positions.getMod();
         if (positions.size() == 0) {
             return IntervalVector({}, 0, mod);
         }
         
-        vector<int> posData = positions.getData();
-        vector<int> intervalData;
+        const VectorData& posData = positions.getData();
+        VectorData intervalData;
         intervalData.reserve(positions.size());
         
         if (posData.size() > 1) {
@@ -41,16 +43,16 @@
      * @brief Converts intervals to positions
      * @return PositionVector derived from current intervals
      */
-    PositionVector intervalsToPositions(IntervalVector intervals) {
+    PositionVector intervalsToPositions(const IntervalVector& intervals) {
         int mod = intervals.getMod();
-        vector<int> intervalData = intervals.getData();
+        const VectorData& intervalData = intervals.getData();
         
         if (intervalData.empty()) {
             return PositionVector({0}, mod, 0, true, false);
         }
         
         // Calculate positions from intervals (starting from offset)
-        vector<int> posData;
+        VectorData posData;
         posData.reserve(intervals.size());
         int currentPos = intervals.getOffset(); 
         posData.emplace_back(currentPos);
@@ -63,12 +65,12 @@
         return PositionVector(posData, mod, 0, true, false);
     }
 
-    BinaryVector positionsToBinary(PositionVector& positions) {
+    BinaryVector positionsToBinary(const PositionVector& positions) {
         if (positions.size() == 0) {
             return BinaryVector({}, 0, positions.mod);
         }
         
-        vector<int> posData = positions.getData();
+        const VectorData& posData = positions.getData();
         int range = positions.getRange();
         vector<int> binaryData(range, 0);
         
@@ -82,4 +84,53 @@
         
         return BinaryVector(binaryData, minPos, range);
     }
+
+    /**
+     * @brief Converts positions to a pitch-class set
+     * @param positions Source positions, reduced modulo their mod
+     * @return PitchClassMask with the same modulus
+     * @throw invalid_argument If the modulus is outside [1, 64]
+     */
+    PitchClassMask positionsToMask(const PositionVector& positions) {
+        return PitchClassMask(positions.getData(), positions.getMod());
+    }
+
+    /**
+     * @brief Converts a pitch-class set to positions
+     * @param mask Source set
+     * @return PositionVector with the pitch classes in ascending order
+     */
+    PositionVector maskToPositions(const PitchClassMask& mask) {
+        return PositionVector(mask.toData(), mask.getMod());
+    }
+
+    /**
+     * @brief Converts a binary pattern to a pitch-class set
+     * @param binary Source pattern, step i is pitch class (offset + i) modulo its length
+     * @return PitchClassMask whose modulus is the pattern length
+     * @throw invalid_argument If the length is outside [1, 64]
+     */
+    PitchClassMask binaryToMask(const BinaryVector& binary) {
+        int length = static_cast<int>(binary.size());
+        if (length < 1 || length > PitchClassMask::MAX_MOD) {
+            throw invalid_argument("BinaryVector length must be between 1 and 64");
+        }
+        uint64_t bits = binary.getWords().empty() ? 0 : binary.getWords()[0];
+        size_t shift = static_cast<size_t>(euclideanDivision(binary.getOffset(), length).remainder);
+        return PitchClassMask::fromBits(rotateBitsLeft(bits, shift, static_cast<size_t>(length)), length);
+    }
+
+    /**
+     * @brief Converts a pitch-class set to a binary pattern
+     * @param mask Source set
+     * @return BinaryVector of length mod with offset 0
+     */
+    BinaryVector maskToBinary(const PitchClassMask& mask) {
+        int mod = mask.getMod();
+        vector<int> steps(mod, 0);
+        for (int pc : mask.toData()) {
+            steps[pc] = 1;
+        }
+        return BinaryVector(steps, 0, mod);
+    }
 #endif // VECTORS_H
\ No newline at end of file